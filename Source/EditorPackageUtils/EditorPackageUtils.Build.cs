@@ -46,9 +46,16 @@ public class EditorPackageUtils : ModuleRules
 				"EditorInteractiveToolsFramework",
                 "Projects",
                 "AssetRegistry",
+                "Json",
+                "JsonUtilities",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
+
+		if (Target.bWithLiveCoding)
+		{
+			PrivateIncludePathModuleNames.Add("LiveCoding");
+		}
 		
 		
 		DynamicallyLoadedModuleNames.AddRange(
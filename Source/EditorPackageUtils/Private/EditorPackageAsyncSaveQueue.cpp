@@ -0,0 +1,201 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageAsyncSaveQueue.h"
+#include "EditorPackageUtilsLog.h"
+#include "EditorPackageUtilsPrivate.h"
+#include "EditorPackageUtilsStats.h"
+#include "Async/Async.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/Package.h"
+
+namespace EditorPackageAsyncSaveQueue
+{
+    static void ApplySaveResult(FEditorPackageSaveResult& Result, const FSavePackageResultStruct& SaveResult)
+    {
+        Result.bSuccess = SaveResult.IsSuccessful();
+        Result.FileSize = SaveResult.TotalFileSize;
+        if (Result.bSuccess)
+        {
+            FEditorPackageUtilsStats::Get().RecordBytesSaved(Result.FileSize);
+        }
+        else
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to save package: %s"), *Result.Filename);
+        }
+    }
+}
+
+FEditorPackageAsyncSaveQueue& FEditorPackageAsyncSaveQueue::Get()
+{
+    static FEditorPackageAsyncSaveQueue Instance;
+    return Instance;
+}
+
+void FEditorPackageAsyncSaveQueue::Initialize()
+{
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEditorPackageAsyncSaveQueue::Tick));
+}
+
+void FEditorPackageAsyncSaveQueue::Shutdown()
+{
+    Flush();
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    TickHandle.Reset();
+}
+
+/**
+ * 저장 요청을 큐에 추가하는 함수.
+ * 패키지 생성과 이동, 에셋 등록, 더티 표시 같은 UObject 작업은 이 자리에서 게임 스레드로 처리하고,
+ * 직렬화와 파일 기록은 이후 틱에서 워커 스레드로 넘깁니다.
+ * 대기열이 MaxPendingSaves에 도달하면 Flush로 진행 중인 배치와 대기열을 바로 비웁니다.
+ */
+TFuture<FEditorPackageSaveResult> FEditorPackageAsyncSaveQueue::Enqueue(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName)
+{
+    check(IsInGameThread());
+
+    TUniquePtr<FQueuedSave> QueuedSave = MakeUnique<FQueuedSave>();
+    TFuture<FEditorPackageSaveResult> Future = QueuedSave->Promise.GetFuture();
+
+    // -- 게임 스레드 UObject 작업
+    UPackage* Package = EditorPackageUtilsPrivate::PrepareAssetForSave(SaveObject, SaveDirectory, FileName, QueuedSave->Result.Filename);
+    if (!Package)
+    {
+        QueuedSave->Promise.SetValue(QueuedSave->Result);
+        return Future;
+    }
+
+    QueuedSave->Object = SaveObject;
+    QueuedSave->Result.Package = Package;
+    PendingSaves.Add(MoveTemp(QueuedSave));
+
+    // -- 대기열이 가득 차면 즉시 처리
+    if (PendingSaves.Num() >= MaxPendingSaves)
+    {
+        Flush();
+    }
+
+    return Future;
+}
+
+void FEditorPackageAsyncSaveQueue::Flush()
+{
+    check(IsInGameThread());
+
+    CompleteBatch();
+    while (PendingSaves.Num() > 0)
+    {
+        StartBatch(PendingSaves.Num());
+        CompleteBatch();
+    }
+}
+
+bool FEditorPackageAsyncSaveQueue::Tick(float DeltaTime)
+{
+    // -- 이전 틱에서 시작한 배치가 끝날 때까지 다음 배치를 미룸
+    if (SavingBatch)
+    {
+        if (!SavingBatch->SaveResults.IsReady())
+        {
+            return true;
+        }
+        CompleteBatch();
+    }
+
+    if (PendingSaves.Num() > 0)
+    {
+        StartBatch(MaxSavesPerTick);
+    }
+
+    return true;
+}
+
+/**
+ * 대기 중인 요청을 배치로 묶어 저장을 시작하는 함수.
+ * 오브젝트를 확인하고 GC에서 보호하는 일만 게임 스레드에서 하고, 직렬화와 파일 기록은 워커 스레드의 태스크에서 처리합니다.
+ * 태스크는 저장하는 동안 FGCScopeGuard로 GC를 막으므로, 그동안 게임 스레드의 GC는 태스크가 끝날 때까지 기다립니다.
+ */
+void FEditorPackageAsyncSaveQueue::StartBatch(int32 MaxSaves)
+{
+    check(!SavingBatch);
+
+    const int32 NumToSave = FMath::Min(MaxSaves, PendingSaves.Num());
+    if (NumToSave <= 0)
+    {
+        return;
+    }
+
+    TUniquePtr<FSaveBatch> Batch = MakeUnique<FSaveBatch>();
+    Batch->Saves.Reserve(NumToSave);
+    for (int32 Index = 0; Index < NumToSave; ++Index)
+    {
+        Batch->Saves.Add(MoveTemp(PendingSaves[Index]));
+    }
+    PendingSaves.RemoveAt(0, NumToSave);
+
+    // -- 저장 전에 GC된 오브젝트는 실패 처리
+    TArray<FPackageSaveInfo> SaveInfos;
+    for (int32 Index = 0; Index < Batch->Saves.Num(); ++Index)
+    {
+        FQueuedSave& QueuedSave = *Batch->Saves[Index];
+        UObject* Object = QueuedSave.Object.Get();
+        if (!Object)
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("SaveObject was destroyed before it could be saved: %s"), *QueuedSave.Result.Filename);
+            QueuedSave.Result.Package = nullptr;
+            continue;
+        }
+
+        // -- 맵 패키지는 워커 스레드에서 저장할 수 없으므로 게임 스레드에서 바로 저장
+        UPackage* Package = Object->GetPackage();
+        if (Package->ContainsMap())
+        {
+            EditorPackageAsyncSaveQueue::ApplySaveResult(QueuedSave.Result, EditorPackageUtilsPrivate::SavePackage(Package, Object, QueuedSave.Result.Filename));
+            continue;
+        }
+
+        FPackageSaveInfo& SaveInfo = SaveInfos.AddDefaulted_GetRef();
+        SaveInfo.Package = Package;
+        SaveInfo.Asset = Object;
+        SaveInfo.Filename = QueuedSave.Result.Filename;
+        Batch->SaveIndices.Add(Index);
+        Batch->KeepAlive.Emplace(Object);
+    }
+
+    // -- 직렬화와 파일 기록을 모두 워커 스레드에서 처리
+    Batch->SaveResults = Async(EAsyncExecution::ThreadPool, [SaveInfos = MoveTemp(SaveInfos)]()
+        {
+            FGCScopeGuard GCGuard;
+
+            TArray<FSavePackageResultStruct> SaveResults;
+            EditorPackageUtilsPrivate::SavePackages(SaveInfos, SAVE_None, SaveResults);
+            return SaveResults;
+        });
+
+    SavingBatch = MoveTemp(Batch);
+}
+
+void FEditorPackageAsyncSaveQueue::CompleteBatch()
+{
+    if (!SavingBatch)
+    {
+        return;
+    }
+
+    // -- 완료 콜백에서 다시 Enqueue하거나 Flush할 수 있으므로 배치를 먼저 꺼냄
+    TUniquePtr<FSaveBatch> Batch = MoveTemp(SavingBatch);
+
+    const TArray<FSavePackageResultStruct>& SaveResults = Batch->SaveResults.Get();
+    for (int32 SaveIndex = 0; SaveIndex < Batch->SaveIndices.Num(); ++SaveIndex)
+    {
+        EditorPackageAsyncSaveQueue::ApplySaveResult(Batch->Saves[Batch->SaveIndices[SaveIndex]]->Result, SaveResults[SaveIndex]);
+    }
+
+    // -- 저장이 끝났으므로 GC 보호를 먼저 풀고 결과를 완료
+    Batch->KeepAlive.Empty();
+    for (TUniquePtr<FQueuedSave>& QueuedSave : Batch->Saves)
+    {
+        QueuedSave->Promise.SetValue(QueuedSave->Result);
+    }
+}
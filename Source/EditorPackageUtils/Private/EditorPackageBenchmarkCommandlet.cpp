@@ -0,0 +1,529 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageBenchmarkCommandlet.h"
+#include "EditorPackageMountTable.h"
+#include "EditorPackageTemporaryMount.h"
+#include "EditorPackageTypeCache.h"
+#include "EditorPackageUtils.h"
+#include "EditorPackageUtilsLog.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Curves/CurveFloat.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace EditorPackageBenchmark
+{
+    /** 측정 항목 하나의 결과. */
+    struct FResult
+    {
+        FString Name;
+        int32 Scale = 0;
+        int64 Ops = 0;
+        double TotalSeconds = 0.0;
+        int64 Allocations = 0;
+
+        double GetNsPerOp() const { return Ops > 0 ? TotalSeconds * 1.0e9 / Ops : 0.0; }
+        double GetAllocsPerOp() const { return Ops > 0 ? (double)Allocations / Ops : 0.0; }
+    };
+
+    /** 스레드마다 FAllocationCounter를 거친 할당 횟수. */
+    static thread_local int64 ThreadAllocationCount = 0;
+
+    /**
+     * GMalloc을 감싸 스레드별 할당 횟수를 세는 할당자.
+     * 횟수는 스레드 로컬에 쌓이므로 측정 스레드의 할당만 결과에 들어가고, 백그라운드 작업은 섞이지 않습니다.
+     * 다른 스레드가 언제든 할당자를 거치고 있을 수 있으므로 처음 한 번 설치한 뒤에는 되돌리거나 해제하지 않습니다.
+     */
+    class FAllocationCounter : public FMalloc
+    {
+    public:
+        /** 처음 호출할 때 GMalloc을 감싸 설치합니다. 이후 호출은 아무것도 하지 않습니다. */
+        static void Install()
+        {
+            check(IsInGameThread());
+
+            static FAllocationCounter* Instance = nullptr;
+            if (!Instance)
+            {
+                // -- 감싸기 전의 할당자로 할당하고 프로세스가 끝날 때까지 해제하지 않음
+                Instance = new FAllocationCounter(GMalloc);
+                GMalloc = Instance;
+            }
+        }
+
+        /** 호출 스레드에서 지금까지 센 할당 횟수. */
+        static int64 GetThreadCount() { return ThreadAllocationCount; }
+
+        virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+        {
+            ++ThreadAllocationCount;
+            return Inner->Malloc(Size, Alignment);
+        }
+
+        virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+        {
+            ++ThreadAllocationCount;
+            return Inner->TryMalloc(Size, Alignment);
+        }
+
+        virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+        {
+            ++ThreadAllocationCount;
+            return Inner->Realloc(Original, Size, Alignment);
+        }
+
+        virtual void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override
+        {
+            ++ThreadAllocationCount;
+            return Inner->TryRealloc(Original, Size, Alignment);
+        }
+
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual SIZE_T QuantizeSize(SIZE_T Size, uint32 Alignment) override { return Inner->QuantizeSize(Size, Alignment); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+        virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+        virtual void UpdateStats() override { Inner->UpdateStats(); }
+        virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+        virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+        virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+    private:
+        explicit FAllocationCounter(FMalloc* InInner)
+            : Inner(InInner)
+        {
+        }
+
+        FMalloc* Inner;
+    };
+
+    /** 측정 결과가 최적화로 사라지지 않도록 모아두는 값. 측정이 끝나면 로그에 남깁니다. */
+    static int64 Sink = 0;
+
+    /**
+     * Body(Index)를 Scale개 항목에 대해 Iterations번 반복 호출하며 시간과 할당 횟수를 측정합니다.
+     */
+    template <typename TBody>
+    FResult Measure(const TCHAR* Name, int32 Scale, int32 Iterations, TBody&& Body)
+    {
+        // -- 캐시 준비를 위해 한 번 미리 호출
+        Body(0);
+
+        FResult Result;
+        Result.Name = Name;
+        Result.Scale = Scale;
+        Result.Ops = (int64)Scale * Iterations;
+
+        const int64 StartAllocations = FAllocationCounter::GetThreadCount();
+        const double StartTime = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            for (int32 Index = 0; Index < Scale; ++Index)
+            {
+                Body(Index);
+            }
+        }
+        Result.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+        Result.Allocations = FAllocationCounter::GetThreadCount() - StartAllocations;
+
+        UE_LOG(LogEditorPackageUtils, Display, TEXT("%-40s %8d %10lld %12.1f ns/op %8.2f allocs/op"),
+            Name, Scale, Result.Ops, Result.GetNsPerOp(), Result.GetAllocsPerOp());
+        return Result;
+    }
+
+    /** 측정에 사용하는 실제 타입 (모듈명, 타입명). */
+    static const TCHAR* const StructNames[][2] =
+    {
+        { TEXT("CoreUObject"), TEXT("Vector") },
+        { TEXT("CoreUObject"), TEXT("Rotator") },
+        { TEXT("CoreUObject"), TEXT("Transform") },
+        { TEXT("CoreUObject"), TEXT("LinearColor") },
+        { TEXT("CoreUObject"), TEXT("Guid") },
+        { TEXT("CoreUObject"), TEXT("DateTime") },
+        { TEXT("Engine"), TEXT("HitResult") },
+        { TEXT("Engine"), TEXT("TableRowBase") },
+    };
+
+    static const TCHAR* const ClassNames[][2] =
+    {
+        { TEXT("Engine"), TEXT("Actor") },
+        { TEXT("Engine"), TEXT("Pawn") },
+        { TEXT("Engine"), TEXT("StaticMeshComponent") },
+        { TEXT("Engine"), TEXT("DataTable") },
+        { TEXT("Engine"), TEXT("CurveFloat") },
+        { TEXT("Engine"), TEXT("Texture2D") },
+        { TEXT("Engine"), TEXT("World") },
+        { TEXT("CoreUObject"), TEXT("Package") },
+    };
+
+    /**
+     * 규모별 합성 플러그인 레이아웃.
+     * 플러그인 절반은 Plugins/Group/ 아래에 중첩해 두고, 입력 경로는 측정 전에 모두 만들어 둡니다.
+     */
+    struct FSyntheticLayout
+    {
+        TArray<FString> MountRoots;
+        TArray<FString> ContentFilePaths;
+        TArray<FString> PluginPackageNames;
+        TArray<FString> GamePackageNames;
+        TArray<FString> SourceFilePaths;
+
+        FSyntheticLayout(const FString& BenchmarkRoot, int32 Scale)
+        {
+            const int32 NumPlugins = FMath::Clamp(Scale / 100, 1, 64);
+            const FString ProjectDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+
+            TArray<FString> ContentDirs;
+            for (int32 PluginIndex = 0; PluginIndex < NumPlugins; ++PluginIndex)
+            {
+                const FString PluginName = FString::Printf(TEXT("EPUBenchPlugin%d"), PluginIndex);
+                const FString PluginDir = (PluginIndex % 2 == 0)
+                    ? FPaths::Combine(BenchmarkRoot, TEXT("Plugins"), PluginName)
+                    : FPaths::Combine(BenchmarkRoot, TEXT("Plugins"), TEXT("Group"), PluginName);
+                const FString ContentDir = FPaths::Combine(PluginDir, TEXT("Content"));
+
+                FEditorPackageMountTable::Get().AddMountRoot(PluginName, ContentDir);
+                MountRoots.Add(PluginName);
+                ContentDirs.Add(ContentDir);
+            }
+
+            ContentFilePaths.Reserve(Scale);
+            PluginPackageNames.Reserve(Scale);
+            GamePackageNames.Reserve(Scale);
+            SourceFilePaths.Reserve(Scale);
+            for (int32 Index = 0; Index < Scale; ++Index)
+            {
+                const int32 PluginIndex = Index % NumPlugins;
+                const int32 FolderIndex = (Index / NumPlugins) % 16;
+
+                ContentFilePaths.Add(FString::Printf(TEXT("%s/Folder%d/Asset%d"), *ContentDirs[PluginIndex], FolderIndex, Index));
+                PluginPackageNames.Add(FString::Printf(TEXT("/Game/Plugins/%s/Folder%d/Asset%d"), *MountRoots[PluginIndex], FolderIndex, Index));
+                GamePackageNames.Add(FString::Printf(TEXT("/Game/Folder%d/Asset%d"), FolderIndex, Index));
+                SourceFilePaths.Add(FString::Printf(TEXT("%sSource/BenchModule%d/Private/File%d.cpp"), *ProjectDir, PluginIndex, Index));
+            }
+        }
+
+        ~FSyntheticLayout()
+        {
+            for (const FString& MountRoot : MountRoots)
+            {
+                FEditorPackageMountTable::Get().RemoveMountRoot(MountRoot);
+            }
+        }
+    };
+
+    static void RunPathBenchmarks(const FString& BenchmarkRoot, int32 Scale, int32 Iterations, TArray<FResult>& OutResults)
+    {
+        FSyntheticLayout Layout(BenchmarkRoot, Scale);
+
+        OutResults.Add(Measure(TEXT("ExtractModuleNameFromPath"), Scale, Iterations, [&Layout](int32 Index)
+            {
+                Sink += EditorPackageUtils::ExtractModuleNameFromPath(Layout.SourceFilePaths[Index]).Len();
+            }));
+
+        OutResults.Add(Measure(TEXT("EnsureUAssetExtension"), Scale, Iterations, [&Layout](int32 Index)
+            {
+                Sink += EditorPackageUtils::EnsureUAssetExtension(Layout.ContentFilePaths[Index]).Len();
+            }));
+
+        OutResults.Add(Measure(TEXT("ConvertFilePathToPackagePath"), Scale, Iterations, [&Layout](int32 Index)
+            {
+                Sink += EditorPackageUtils::ConvertFilePathToPackagePath(Layout.ContentFilePaths[Index]).Len();
+            }));
+
+        OutResults.Add(Measure(TEXT("PluginLongPackageNameToFilename"), Scale, Iterations, [&Layout](int32 Index)
+            {
+                Sink += EditorPackageUtils::PluginLongPackageNameToFilename(Layout.PluginPackageNames[Index]).Len();
+            }));
+
+        // -- 문자열 뷰/빌더 버전 (힙 할당이 없어야 함)
+        OutResults.Add(Measure(TEXT("ExtractModuleNameFromPath (view)"), Scale, Iterations, [&Layout](int32 Index)
+            {
+                FStringView ModuleName;
+                EditorPackageUtils::ExtractModuleNameFromPath(FStringView(Layout.SourceFilePaths[Index]), ModuleName);
+                Sink += ModuleName.Len();
+            }));
+
+        OutResults.Add(Measure(TEXT("EnsureUAssetExtension (builder)"), Scale, Iterations, [&Layout](int32 Index)
+            {
+                TStringBuilder<512> FilePath;
+                EditorPackageUtils::EnsureUAssetExtension(FStringView(Layout.ContentFilePaths[Index]), FilePath);
+                Sink += FilePath.Len();
+            }));
+
+        OutResults.Add(Measure(TEXT("PluginLongPackageNameToFilename (builder)"), Scale, Iterations, [&Layout](int32 Index)
+            {
+                TStringBuilder<512> Filename;
+                EditorPackageUtils::PluginLongPackageNameToFilename(FStringView(Layout.PluginPackageNames[Index]), Filename);
+                Sink += Filename.Len();
+            }));
+
+        OutResults.Add(Measure(TEXT("PluginLongPackageNameToFilename (/Game, builder)"), Scale, Iterations, [&Layout](int32 Index)
+            {
+                TStringBuilder<512> Filename;
+                EditorPackageUtils::PluginLongPackageNameToFilename(FStringView(Layout.GamePackageNames[Index]), Filename);
+                Sink += Filename.Len();
+            }));
+    }
+
+    static void RunTypeBenchmarks(int32 Scale, int32 Iterations, TArray<FResult>& OutResults)
+    {
+        const int32 NumStructs = UE_ARRAY_COUNT(StructNames);
+        const int32 NumClasses = UE_ARRAY_COUNT(ClassNames);
+
+        TArray<FString> StructModuleStrings, StructTypeStrings, ClassModuleStrings, ClassTypeStrings;
+        TArray<FName> StructModuleNames, StructTypeNames, ClassModuleNames, ClassTypeNames;
+        for (int32 Index = 0; Index < Scale; ++Index)
+        {
+            StructModuleStrings.Add(StructNames[Index % NumStructs][0]);
+            StructTypeStrings.Add(StructNames[Index % NumStructs][1]);
+            StructModuleNames.Add(StructNames[Index % NumStructs][0]);
+            StructTypeNames.Add(StructNames[Index % NumStructs][1]);
+
+            ClassModuleStrings.Add(ClassNames[Index % NumClasses][0]);
+            ClassTypeStrings.Add(ClassNames[Index % NumClasses][1]);
+            ClassModuleNames.Add(ClassNames[Index % NumClasses][0]);
+            ClassTypeNames.Add(ClassNames[Index % NumClasses][1]);
+        }
+
+        // -- 캐시를 비운 첫 조회 (FindObject/LoadObject 경로)
+        FEditorPackageTypeCache::Get().Invalidate();
+        OutResults.Add(Measure(TEXT("ResolveStructDefinition (cold)"), FMath::Min(Scale, NumStructs), 1, [&](int32 Index)
+            {
+                FEditorPackageTypeCache::Get().Invalidate();
+                Sink += EditorPackageUtils::ResolveStructDefinition(StructModuleNames[Index], StructTypeNames[Index]) != nullptr;
+            }));
+
+        OutResults.Add(Measure(TEXT("LoadStructDefinitionByName"), Scale, Iterations, [&](int32 Index)
+            {
+                Sink += EditorPackageUtils::LoadStructDefinitionByName(StructModuleStrings[Index], StructTypeStrings[Index]) != nullptr;
+            }));
+
+        OutResults.Add(Measure(TEXT("ResolveStructDefinition"), Scale, Iterations, [&](int32 Index)
+            {
+                Sink += EditorPackageUtils::ResolveStructDefinition(StructModuleNames[Index], StructTypeNames[Index]) != nullptr;
+            }));
+
+        OutResults.Add(Measure(TEXT("LoadClassDefinitionByName"), Scale, Iterations, [&](int32 Index)
+            {
+                Sink += EditorPackageUtils::LoadClassDefinitionByName(ClassModuleStrings[Index], ClassTypeStrings[Index]) != nullptr;
+            }));
+
+        OutResults.Add(Measure(TEXT("ResolveClassDefinition"), Scale, Iterations, [&](int32 Index)
+            {
+                Sink += EditorPackageUtils::ResolveClassDefinition(ClassModuleNames[Index], ClassTypeNames[Index]) != nullptr;
+            }));
+    }
+
+    static TArray<UObject*> CreateSaveObjects(int32 Scale)
+    {
+        TArray<UObject*> Objects;
+        Objects.Reserve(Scale);
+        for (int32 Index = 0; Index < Scale; ++Index)
+        {
+            UCurveFloat* Curve = NewObject<UCurveFloat>(GetTransientPackage(), NAME_None, RF_Public | RF_Standalone);
+            Curve->FloatCurve.AddKey(0.0f, (float)Index);
+            Curve->FloatCurve.AddKey(1.0f, (float)(Index + 1));
+            Objects.Add(Curve);
+        }
+        return Objects;
+    }
+
+    static void DestroySaveObjects(TArray<UObject*>& Objects)
+    {
+        for (UObject* Object : Objects)
+        {
+            if (UPackage* Package = Object->GetPackage())
+            {
+                Package->ClearFlags(RF_Standalone);
+            }
+            if (Object->GetPackage() != GetTransientPackage())
+            {
+                FAssetRegistryModule::AssetDeleted(Object);
+            }
+            Object->ClearFlags(RF_Public | RF_Standalone);
+            Object->MarkAsGarbage();
+        }
+        Objects.Reset();
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    }
+
+    /**
+     * 패키지 저장을 측정합니다.
+     * 프로젝트 Content 대신 BenchmarkRoot 아래에 임시 콘텐츠 루트를 마운트해 저장하고, 끝나면 마운트와 파일을 함께 제거합니다.
+     */
+    static void RunSaveBenchmarks(const FString& BenchmarkRoot, int32 Scale, TArray<FResult>& OutResults)
+    {
+        const FEditorPackageTemporaryMount SaveMount(TEXT("EPUBenchmarkSave"), FPaths::Combine(BenchmarkRoot, TEXT("SaveContent")));
+        const FString& SaveRoot = SaveMount.GetContentDir();
+
+        // -- 패키지를 하나씩 저장
+        {
+            const FString SaveDirectory = FPaths::Combine(SaveRoot, FString::Printf(TEXT("Single%d"), Scale));
+            TArray<UObject*> Objects = CreateSaveObjects(Scale);
+
+            FResult Result;
+            Result.Name = TEXT("SaveAssetToPackage");
+            Result.Scale = Scale;
+            Result.Ops = Scale;
+
+            const double StartTime = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < Scale; ++Index)
+            {
+                Sink += EditorPackageUtils::SaveAssetToPackage(Objects[Index], SaveDirectory, FString::Printf(TEXT("Curve%d"), Index), RF_Public | RF_Standalone) != nullptr;
+            }
+            Result.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+            UE_LOG(LogEditorPackageUtils, Display, TEXT("%-40s %8d %10lld %12.1f ns/op"), *Result.Name, Scale, Result.Ops, Result.GetNsPerOp());
+            OutResults.Add(MoveTemp(Result));
+
+            DestroySaveObjects(Objects);
+        }
+
+        // -- 패키지를 한 번에 저장
+        {
+            const FString SaveDirectory = FPaths::Combine(SaveRoot, FString::Printf(TEXT("Batch%d"), Scale));
+            TArray<UObject*> Objects = CreateSaveObjects(Scale);
+
+            TArray<FEditorPackageSaveItem> Items;
+            Items.Reserve(Scale);
+            for (int32 Index = 0; Index < Scale; ++Index)
+            {
+                FEditorPackageSaveItem& Item = Items.AddDefaulted_GetRef();
+                Item.Object = Objects[Index];
+                Item.SaveDirectory = SaveDirectory;
+                Item.FileName = FString::Printf(TEXT("Curve%d"), Index);
+            }
+
+            FResult Result;
+            Result.Name = TEXT("SaveAssetsToPackages");
+            Result.Scale = Scale;
+            Result.Ops = Scale;
+
+            const double StartTime = FPlatformTime::Seconds();
+            Sink += EditorPackageUtils::SaveAssetsToPackages(Items).Num();
+            Result.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+            UE_LOG(LogEditorPackageUtils, Display, TEXT("%-40s %8d %10lld %12.1f ns/op"), *Result.Name, Scale, Result.Ops, Result.GetNsPerOp());
+            OutResults.Add(MoveTemp(Result));
+
+            DestroySaveObjects(Objects);
+        }
+    }
+
+    static bool WriteResults(const FString& Filename, const TArray<FResult>& Results)
+    {
+        FString Json;
+        TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("formatVersion"), 1);
+        Writer->WriteValue(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+        Writer->WriteValue(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+        Writer->WriteValue(TEXT("configuration"), FString(LexToString(FApp::GetBuildConfiguration())));
+        Writer->WriteValue(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+
+        Writer->WriteArrayStart(TEXT("results"));
+        for (const FResult& Result : Results)
+        {
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("name"), Result.Name);
+            Writer->WriteValue(TEXT("scale"), Result.Scale);
+            Writer->WriteValue(TEXT("ops"), Result.Ops);
+            Writer->WriteValue(TEXT("totalMs"), Result.TotalSeconds * 1000.0);
+            Writer->WriteValue(TEXT("nsPerOp"), Result.GetNsPerOp());
+            Writer->WriteValue(TEXT("allocsPerOp"), Result.GetAllocsPerOp());
+            Writer->WriteObjectEnd();
+        }
+        Writer->WriteArrayEnd();
+
+        Writer->WriteObjectEnd();
+        Writer->Close();
+
+        return FFileHelper::SaveStringToFile(Json, *Filename);
+    }
+}
+
+UEditorPackageBenchmarkCommandlet::UEditorPackageBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 UEditorPackageBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace EditorPackageBenchmark;
+
+    // -- 인자 처리
+    TArray<int32> Scales;
+    FString ScalesString;
+    if (FParse::Value(*Params, TEXT("Scales="), ScalesString, false))
+    {
+        TArray<FString> ScaleStrings;
+        ScalesString.ParseIntoArray(ScaleStrings, TEXT(","));
+        for (const FString& ScaleString : ScaleStrings)
+        {
+            const int32 Scale = FCString::Atoi(*ScaleString);
+            if (Scale > 0)
+            {
+                Scales.Add(Scale);
+            }
+        }
+    }
+    if (Scales.Num() == 0)
+    {
+        Scales = { 1, 100, 10000 };
+    }
+
+    int32 MinOps = 100000;
+    FParse::Value(*Params, TEXT("MinOps="), MinOps);
+
+    FString OutputFilename = FPaths::Combine(FPaths::ProfilingDir(), TEXT("EditorPackageUtilsBenchmark.json"));
+    FParse::Value(*Params, TEXT("Output="), OutputFilename);
+
+    const bool bSkipSave = FParse::Param(*Params, TEXT("NoSave"));
+
+    const FString BenchmarkRoot = FPaths::Combine(FPaths::ConvertRelativePathToFull(FPaths::ProjectIntermediateDir()), TEXT("EditorPackageUtilsBenchmark"));
+
+    // -- 측정
+    FAllocationCounter::Install();
+    UE_LOG(LogEditorPackageUtils, Display, TEXT("%-40s %8s %10s %15s %18s"), TEXT("Benchmark"), TEXT("Scale"), TEXT("Ops"), TEXT("Time"), TEXT("Allocations"));
+
+    TArray<FResult> Results;
+    for (const int32 Scale : Scales)
+    {
+        const int32 Iterations = FMath::Max(1, MinOps / Scale);
+
+        RunPathBenchmarks(BenchmarkRoot, Scale, Iterations, Results);
+        RunTypeBenchmarks(Scale, Iterations, Results);
+        if (!bSkipSave)
+        {
+            RunSaveBenchmarks(BenchmarkRoot, Scale, Results);
+        }
+    }
+
+    if (!WriteResults(OutputFilename, Results))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to write benchmark results: %s"), *OutputFilename);
+        return 1;
+    }
+
+    UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Benchmark checksum: %lld"), Sink);
+    UE_LOG(LogEditorPackageUtils, Display, TEXT("Wrote %d benchmark results to %s"), Results.Num(), *OutputFilename);
+    return 0;
+}
@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EditorPackageBenchmarkCommandlet.generated.h"
+
+/**
+ * EditorPackageUtils API 마이크로 벤치마크 커맨드렛.
+ *
+ * 합성 플러그인 레이아웃(중첩 플러그인 폴더 포함)을 마운트 테이블에 등록하고
+ * 경로 변환, 모듈명 추출, 타입 조회, 패키지 저장을 에셋 규모별로 측정해 JSON으로 기록합니다.
+ * 측정 항목마다 호출당 시간(ns)과 호출 스레드의 힙 할당 횟수를 기록하므로 버전 간 결과를 비교할 수 있습니다.
+ * 저장 측정은 Intermediate 아래에 임시로 마운트한 콘텐츠 루트에 기록하고 끝나면 제거하므로 프로젝트 Content에는 남지 않습니다.
+ *
+ * 사용법:
+ *   UnrealEditor-Cmd <Project>.uproject -run=EditorPackageBenchmark -nullrhi -unattended [옵션]
+ *
+ * 옵션:
+ *   -Scales=1,100,10000  측정할 에셋 규모 (기본: 1,100,10000)
+ *   -MinOps=100000       경로/타입 항목마다 최소 호출 횟수. 규모가 작으면 반복 횟수를 늘립니다.
+ *   -Output=<Filename>   결과 JSON 경로 (기본: Saved/Profiling/EditorPackageUtilsBenchmark.json)
+ *   -NoSave              패키지 저장 측정을 생략합니다.
+ */
+UCLASS()
+class UEditorPackageBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UEditorPackageBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
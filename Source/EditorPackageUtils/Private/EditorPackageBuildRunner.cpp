@@ -0,0 +1,439 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageBuildRunner.h"
+#include "EditorPackageUtilsLog.h"
+#include "Async/Async.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/FileManager.h"
+#include "Hash/xxhash.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/App.h"
+#include "Misc/MonitoredProcess.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#if WITH_LIVE_CODING
+#include "ILiveCodingModule.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "EditorPackageBuildRunner"
+
+namespace EditorPackageBuildRunner
+{
+    /** 빌드 기록 파일 식별자와 형식 버전. */
+    static constexpr uint32 FileMagic = 0x42555045; // "EPUB"
+    static constexpr int32 FileVersion = 1;
+
+    /** 지문에 넣을 파일 하나. */
+    struct FFileStamp
+    {
+        FString Filename;
+        int64 Ticks = 0;
+        int64 Size = 0;
+    };
+
+    static void AddFileStamp(TArray<FFileStamp>& OutStamps, const FString& Filename)
+    {
+        const FFileStatData StatData = IFileManager::Get().GetStatData(*Filename);
+        if (StatData.bIsValid)
+        {
+            OutStamps.Add({ Filename, StatData.ModificationTime.GetTicks(), StatData.FileSize });
+        }
+    }
+
+    /** Directory의 파일들을 OutStamps에 추가합니다. 디렉터리가 없으면 아무것도 하지 않습니다. */
+    static void AddDirectoryStamps(TArray<FFileStamp>& OutStamps, const FString& Directory, bool bRecursive)
+    {
+        auto Visitor = [&OutStamps](const TCHAR* Filename, const FFileStatData& StatData)
+            {
+                if (!StatData.bIsDirectory)
+                {
+                    OutStamps.Add({ FString(Filename), StatData.ModificationTime.GetTicks(), StatData.FileSize });
+                }
+                return true;
+            };
+
+        if (bRecursive)
+        {
+            IFileManager::Get().IterateDirectoryStatRecursively(*Directory, Visitor);
+        }
+        else
+        {
+            IFileManager::Get().IterateDirectoryStat(*Directory, Visitor);
+        }
+    }
+
+    /** 디렉터리 순회 순서와 관계없도록 파일명으로 정렬한 뒤 해시합니다. */
+    static uint64 HashStamps(TArray<FFileStamp>& Stamps)
+    {
+        Stamps.Sort([](const FFileStamp& A, const FFileStamp& B) { return A.Filename < B.Filename; });
+
+        FXxHash64Builder Builder;
+        for (const FFileStamp& Stamp : Stamps)
+        {
+            const int32 Len = Stamp.Filename.Len();
+            Builder.Update(&Len, sizeof(Len));
+            Builder.Update(*Stamp.Filename, Len * sizeof(TCHAR));
+            Builder.Update(&Stamp.Ticks, sizeof(Stamp.Ticks));
+            Builder.Update(&Stamp.Size, sizeof(Stamp.Size));
+        }
+
+        // -- 0은 "기록 없음"으로 사용하므로 피함
+        const uint64 Hash = Builder.Finalize().Hash;
+        return Hash != 0 ? Hash : 1;
+    }
+
+    /** 프로젝트 디렉터리에서 로드한 활성화된 플러그인. */
+    static TArray<TSharedRef<IPlugin>> GetProjectPlugins()
+    {
+        TArray<TSharedRef<IPlugin>> Plugins = IPluginManager::Get().GetEnabledPlugins();
+        Plugins.RemoveAll([](const TSharedRef<IPlugin>& Plugin) { return Plugin->GetLoadedFrom() != EPluginLoadedFrom::Project; });
+        return Plugins;
+    }
+}
+
+FEditorPackageBuildRunner& FEditorPackageBuildRunner::Get()
+{
+    static FEditorPackageBuildRunner Instance;
+    return Instance;
+}
+
+void FEditorPackageBuildRunner::Initialize()
+{
+    SessionBinaryFingerprint = ComputeBinaryFingerprint();
+    LoadLastBuild();
+}
+
+void FEditorPackageBuildRunner::Shutdown()
+{
+    if (Process.IsValid())
+    {
+        Process->OnOutput().Unbind();
+        Process->OnCompleted().Unbind();
+        Process->OnCanceled().Unbind();
+        Process->Cancel(true);
+        Process.Reset();
+    }
+    NotificationItem.Reset();
+    OnBuildFinished.Unbind();
+}
+
+/**
+ * 현재 플랫폼에 맞는 UnrealBuildTool 경로를 찾는 함수.
+ * 엔진의 UnrealBuildTool 실행 파일을 먼저 찾고, 없으면 플랫폼별 Build 스크립트를 사용합니다.
+ * Build 스크립트는 UBT와 같은 인자를 받습니다.
+ */
+FString FEditorPackageBuildRunner::FindUnrealBuildTool()
+{
+    const FString EngineDir = FPaths::ConvertRelativePathToFull(FPaths::EngineDir());
+
+    const FString Candidates[] =
+    {
+#if PLATFORM_WINDOWS
+        FPaths::Combine(EngineDir, TEXT("Binaries"), TEXT("DotNET"), TEXT("UnrealBuildTool"), TEXT("UnrealBuildTool.exe")),
+        FPaths::Combine(EngineDir, TEXT("Build"), TEXT("BatchFiles"), TEXT("Build.bat")),
+#elif PLATFORM_MAC
+        FPaths::Combine(EngineDir, TEXT("Binaries"), TEXT("DotNET"), TEXT("UnrealBuildTool"), TEXT("UnrealBuildTool")),
+        FPaths::Combine(EngineDir, TEXT("Build"), TEXT("BatchFiles"), TEXT("Mac"), TEXT("Build.sh")),
+#else
+        FPaths::Combine(EngineDir, TEXT("Binaries"), TEXT("DotNET"), TEXT("UnrealBuildTool"), TEXT("UnrealBuildTool")),
+        FPaths::Combine(EngineDir, TEXT("Build"), TEXT("BatchFiles"), TEXT("Linux"), TEXT("Build.sh")),
+#endif
+    };
+
+    for (const FString& Candidate : Candidates)
+    {
+        if (FPaths::FileExists(Candidate))
+        {
+            return Candidate;
+        }
+    }
+
+    UE_LOG(LogEditorPackageUtils, Error, TEXT("UnrealBuildTool could not be found under: %s"), *EngineDir);
+    return FString();
+}
+
+FString FEditorPackageBuildRunner::MakeEditorTargetArguments()
+{
+    const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+
+    FString TargetName = FPlatformMisc::GetUBTTargetName();
+    if (TargetName.IsEmpty())
+    {
+        TargetName = FString(FApp::GetProjectName()) + TEXT("Editor");
+    }
+
+    return FString::Printf(TEXT("%s %s %s -Project=\"%s\" -WaitMutex -FromMsBuild"),
+        *TargetName, FPlatformMisc::GetUBTPlatform(), LexToString(FApp::GetBuildConfiguration()), *ProjectPath);
+}
+
+bool FEditorPackageBuildRunner::IsLiveCodingEnabled()
+{
+#if WITH_LIVE_CODING
+    ILiveCodingModule* LiveCoding = FModuleManager::GetModulePtr<ILiveCodingModule>(LIVE_CODING_MODULE_NAME);
+    return LiveCoding && LiveCoding->IsEnabledForSession();
+#else
+    return false;
+#endif
+}
+
+uint64 FEditorPackageBuildRunner::ComputeSourceFingerprint()
+{
+    using namespace EditorPackageBuildRunner;
+
+    TArray<FFileStamp> Stamps;
+    AddFileStamp(Stamps, FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()));
+    AddDirectoryStamps(Stamps, FPaths::ConvertRelativePathToFull(FPaths::GameSourceDir()), true);
+
+    for (const TSharedRef<IPlugin>& Plugin : GetProjectPlugins())
+    {
+        AddFileStamp(Stamps, Plugin->GetDescriptorFileName());
+        AddDirectoryStamps(Stamps, FPaths::Combine(Plugin->GetBaseDir(), TEXT("Source")), true);
+    }
+
+    return HashStamps(Stamps);
+}
+
+uint64 FEditorPackageBuildRunner::ComputeBinaryFingerprint()
+{
+    using namespace EditorPackageBuildRunner;
+
+    const TCHAR* BinariesSubdirectory = FPlatformProcess::GetBinariesSubdirectory();
+
+    TArray<FFileStamp> Stamps;
+    AddDirectoryStamps(Stamps, FPaths::Combine(FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()), TEXT("Binaries"), BinariesSubdirectory), false);
+
+    for (const TSharedRef<IPlugin>& Plugin : GetProjectPlugins())
+    {
+        AddDirectoryStamps(Stamps, FPaths::Combine(Plugin->GetBaseDir(), TEXT("Binaries"), BinariesSubdirectory), false);
+    }
+
+    return HashStamps(Stamps);
+}
+
+bool FEditorPackageBuildRunner::IsBuildUpToDate(uint64 SourceFingerprint, uint64 BinaryFingerprint) const
+{
+    return LastBuildSourceFingerprint != 0
+        && LastBuildSourceFingerprint == SourceFingerprint
+        && LastBuildBinaryFingerprint == BinaryFingerprint;
+}
+
+FString FEditorPackageBuildRunner::GetLastBuildFilename()
+{
+    return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("EditorPackageUtils"), TEXT("LastBuild.bin"));
+}
+
+bool FEditorPackageBuildRunner::LoadLastBuild()
+{
+    LastBuildSourceFingerprint = 0;
+    LastBuildBinaryFingerprint = 0;
+
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetLastBuildFilename(), FILEREAD_Silent));
+    if (!Reader)
+    {
+        return false;
+    }
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    uint64 SourceFingerprint = 0;
+    uint64 BinaryFingerprint = 0;
+    *Reader << Magic << Version << SourceFingerprint << BinaryFingerprint;
+    if (Reader->IsError() || Magic != EditorPackageBuildRunner::FileMagic || Version != EditorPackageBuildRunner::FileVersion)
+    {
+        return false;
+    }
+
+    LastBuildSourceFingerprint = SourceFingerprint;
+    LastBuildBinaryFingerprint = BinaryFingerprint;
+    return true;
+}
+
+void FEditorPackageBuildRunner::RecordSuccessfulBuild(uint64 SourceFingerprint, uint64 BinaryFingerprint)
+{
+    LastBuildSourceFingerprint = SourceFingerprint;
+    LastBuildBinaryFingerprint = BinaryFingerprint;
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*GetLastBuildFilename()));
+    if (!Writer)
+    {
+        UE_LOG(LogEditorPackageUtils, Warning, TEXT("Failed to write build record: %s"), *GetLastBuildFilename());
+        return;
+    }
+
+    uint32 Magic = EditorPackageBuildRunner::FileMagic;
+    int32 Version = EditorPackageBuildRunner::FileVersion;
+    *Writer << Magic << Version << SourceFingerprint << BinaryFingerprint;
+}
+
+/**
+ * UnrealBuildTool을 비동기로 실행하는 함수.
+ * 시작하지 못하면 콜백과 노티피케이션 없이 false를 반환하고, 시작한 뒤의 결과는 항상 OnFinished로 전달합니다.
+ */
+bool FEditorPackageBuildRunner::StartBuild(const FString& Arguments, const FText& StatusText, FOnEditorPackageBuildFinished OnFinished)
+{
+    check(IsInGameThread());
+
+    if (Process.IsValid())
+    {
+        UE_LOG(LogEditorPackageUtils, Warning, TEXT("A build is already running."));
+        return false;
+    }
+
+    const FString UBTPath = FindUnrealBuildTool();
+    if (UBTPath.IsEmpty())
+    {
+        return false;
+    }
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("Running %s %s"), *UBTPath, *Arguments);
+
+    StartTime = FPlatformTime::Seconds();
+    LaunchedTime = StartTime;
+    ExitedTime = StartTime;
+
+    // -- 출력 파이프를 연결해 UBT 프로세스 실행. 출력과 완료 처리는 게임 스레드로 넘기므로 아래 설정보다 먼저 실행되지 않음
+    Process = MakeShared<FMonitoredProcess>(UBTPath, Arguments, true, true);
+    Process->OnOutput().BindRaw(this, &FEditorPackageBuildRunner::HandleOutput);
+    Process->OnCompleted().BindRaw(this, &FEditorPackageBuildRunner::HandleCompleted);
+    Process->OnCanceled().BindRaw(this, &FEditorPackageBuildRunner::HandleCanceled);
+
+    if (!Process->Launch())
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to start build process."));
+        Process.Reset();
+        return false;
+    }
+
+    LaunchedTime = FPlatformTime::Seconds();
+    OnBuildFinished = MoveTemp(OnFinished);
+
+    // 빌드 진행 상태를 알리기 위한 노티피케이션 생성
+    FNotificationInfo Info(StatusText);
+    Info.bFireAndForget = false;  // 자동으로 사라지지 않도록 설정
+    Info.FadeOutDuration = 0.5f;
+    Info.ExpireDuration = 0.0f;
+    Info.bUseThrobber = true;  // 계속 도는 아이콘 사용
+    Info.bUseSuccessFailIcons = true;
+    Info.ButtonDetails.Add(FNotificationButtonInfo(
+        LOCTEXT("CancelBuild", "Cancel"),
+        LOCTEXT("CancelBuildTooltip", "Cancel the running build."),
+        FSimpleDelegate::CreateRaw(this, &FEditorPackageBuildRunner::Cancel),
+        SNotificationItem::CS_Pending));
+
+    NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
+    if (NotificationItem.IsValid())
+    {
+        NotificationItem->SetCompletionState(SNotificationItem::CS_Pending);  // 빌드 진행 중 상태로 설정
+    }
+
+    return true;
+}
+
+void FEditorPackageBuildRunner::Cancel()
+{
+    if (Process.IsValid())
+    {
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Canceling build..."));
+        Process->Cancel(true);
+    }
+}
+
+/**
+ * UBT 출력 한 줄을 처리하는 함수. 모니터 스레드에서 호출됩니다.
+ * 모든 줄은 바로 로그에 기록하고, 노티피케이션은 게임 스레드에 한 번에 하나의 갱신만 예약해 마지막 줄로 표시합니다.
+ */
+void FEditorPackageBuildRunner::HandleOutput(FString Output)
+{
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("UBT: %s"), *Output);
+
+    {
+        FScopeLock Lock(&LatestOutputLock);
+        LatestOutput = MoveTemp(Output);
+    }
+
+    if (!bNotificationUpdatePending.exchange(true))
+    {
+        AsyncTask(ENamedThreads::GameThread, [this]()
+            {
+                bNotificationUpdatePending = false;
+
+                FString Line;
+                {
+                    FScopeLock Lock(&LatestOutputLock);
+                    Line = LatestOutput;
+                }
+
+                if (NotificationItem.IsValid())
+                {
+                    NotificationItem->SetSubText(FText::FromString(Line));
+                }
+            });
+    }
+}
+
+void FEditorPackageBuildRunner::HandleCompleted(int32 ReturnCode)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    // 메인 스레드에서 후속 작업 실행
+    AsyncTask(ENamedThreads::GameThread, [this, ReturnCode, Now]()
+        {
+            ExitedTime = Now;
+            Finish(ReturnCode, false);
+        });
+}
+
+void FEditorPackageBuildRunner::HandleCanceled()
+{
+    const double Now = FPlatformTime::Seconds();
+
+    AsyncTask(ENamedThreads::GameThread, [this, Now]()
+        {
+            ExitedTime = Now;
+            Finish(-1, true);
+        });
+}
+
+void FEditorPackageBuildRunner::Finish(int32 ReturnCode, bool bCanceled)
+{
+    check(IsInGameThread());
+
+    FEditorPackageBuildResult Result;
+    Result.ReturnCode = ReturnCode;
+    Result.bCanceled = bCanceled;
+    Result.bSuccess = !bCanceled && ReturnCode == 0;
+    Result.LaunchSeconds = LaunchedTime - StartTime;
+    Result.CompileSeconds = FMath::Max(0.0, ExitedTime - LaunchedTime);
+    Result.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("Build %s (code %d). Launch %.2fs, compile %.2fs, total %.2fs"),
+        Result.bSuccess ? TEXT("succeeded") : (bCanceled ? TEXT("canceled") : TEXT("failed")),
+        ReturnCode, Result.LaunchSeconds, Result.CompileSeconds, Result.TotalSeconds);
+
+    if (NotificationItem.IsValid())
+    {
+        if (Result.bSuccess)
+        {
+            NotificationItem->SetText(LOCTEXT("BuildSucceeded", "Build completed successfully!"));
+            NotificationItem->SetCompletionState(SNotificationItem::CS_Success);  // 성공 상태로 업데이트
+        }
+        else
+        {
+            NotificationItem->SetText(bCanceled ? LOCTEXT("BuildCanceled", "Build canceled.") : LOCTEXT("BuildFailed", "Build failed!"));
+            NotificationItem->SetCompletionState(SNotificationItem::CS_Fail);  // 실패 상태로 업데이트
+        }
+        NotificationItem->SetSubText(FText::Format(LOCTEXT("BuildTiming", "{0} s"), FText::AsNumber(Result.TotalSeconds)));
+        NotificationItem->ExpireAndFadeout();
+    }
+
+    // -- 모니터 스레드가 끝난 뒤 게임 스레드에서 프로세스 정리
+    Process.Reset();
+    NotificationItem.Reset();
+
+    FOnEditorPackageBuildFinished Callback = MoveTemp(OnBuildFinished);
+    OnBuildFinished.Unbind();
+    Callback.ExecuteIfBound(Result);
+}
+
+#undef LOCTEXT_NAMESPACE
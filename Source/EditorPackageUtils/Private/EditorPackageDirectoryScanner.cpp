@@ -0,0 +1,229 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageDirectoryScanner.h"
+#include "EditorPackageMountTable.h"
+#include "EditorPackageUtilsLog.h"
+#include "EditorPackageUtilsPrivate.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/StringBuilder.h"
+
+namespace EditorPackageDirectoryScanner
+{
+    /** 루트에서 하위 디렉터리를 펼칠 최대 단계. 이보다 깊은 트리는 펼친 디렉터리 단위로 나눠 순회합니다. */
+    constexpr int32 MaxSplitDepth = 3;
+
+    /** 워커 스레드당 목표 작업 수. 하위 트리 크기가 고르지 않아도 스레드가 놀지 않도록 여유를 둡니다. */
+    constexpr int32 TasksPerWorker = 4;
+
+    /** 작업 하나가 모은 결과. 오프셋은 StringData 기준이며 합칠 때 보정합니다. */
+    struct FTaskOutput
+    {
+        TArray<TCHAR> StringData;
+        TArray<FEditorPackageScanEntry> Entries;
+        int32 NumUnconvertible = 0;
+    };
+
+    /** 패키지 확장자면 그 길이를, 아니면 0을 반환합니다. */
+    static int32 GetPackageExtensionLen(FStringView Filename, bool& bOutIsMap)
+    {
+        static const FStringView AssetExtension = TEXTVIEW(".uasset");
+        static const FStringView MapExtension = TEXTVIEW(".umap");
+
+        if (Filename.EndsWith(AssetExtension, ESearchCase::IgnoreCase))
+        {
+            bOutIsMap = false;
+            return AssetExtension.Len();
+        }
+        if (Filename.EndsWith(MapExtension, ESearchCase::IgnoreCase))
+        {
+            bOutIsMap = true;
+            return MapExtension.Len();
+        }
+        return 0;
+    }
+
+    static void AddFile(FStringView Filename, const FEditorPackageMountSnapshot& MountSnapshot, FStringBuilderBase& PackageName, FTaskOutput& Output)
+    {
+        bool bIsMap = false;
+        const int32 ExtensionLen = GetPackageExtensionLen(Filename, bIsMap);
+        if (ExtensionLen == 0)
+        {
+            return;
+        }
+
+        PackageName.Reset();
+        if (!MountSnapshot.TryConvertFilenameToPackageName(Filename.LeftChop(ExtensionLen), PackageName))
+        {
+            ++Output.NumUnconvertible;
+            return;
+        }
+
+        FEditorPackageScanEntry& Entry = Output.Entries.AddDefaulted_GetRef();
+        Entry.bIsMap = bIsMap;
+
+        Entry.FilenameOffset = Output.StringData.Num();
+        Entry.FilenameLen = Filename.Len();
+        Output.StringData.Append(Filename.GetData(), Filename.Len());
+
+        Entry.PackageNameOffset = Output.StringData.Num();
+        Entry.PackageNameLen = PackageName.Len();
+        Output.StringData.Append(PackageName.GetData(), PackageName.Len());
+    }
+
+    static void AppendOutput(FTaskOutput& Output, FEditorPackageScanResult& OutResult)
+    {
+        const int32 BaseOffset = OutResult.StringData.Num();
+        OutResult.StringData.Append(Output.StringData);
+
+        for (FEditorPackageScanEntry Entry : Output.Entries)
+        {
+            Entry.FilenameOffset += BaseOffset;
+            Entry.PackageNameOffset += BaseOffset;
+            OutResult.Entries.Add(Entry);
+        }
+        OutResult.NumUnconvertible += Output.NumUnconvertible;
+    }
+
+    /**
+     * 찾은 패키지의 Asset Registry 등록 여부를 표시합니다.
+     * 패키지 이름 필터 하나로 조회하므로 패키지 수와 관계없이 레지스트리 잠금은 한 번만 잡습니다.
+     */
+    static void QueryRegistry(FEditorPackageScanResult& OutResult)
+    {
+        IAssetRegistry& AssetRegistry = EditorPackageUtilsPrivate::GetAssetRegistry();
+
+        TMap<FName, int32> PackageToEntry;
+        PackageToEntry.Reserve(OutResult.Num());
+
+        FARFilter Filter;
+        Filter.PackageNames.Reserve(OutResult.Num());
+        Filter.bIncludeOnlyOnDiskAssets = true;
+
+        for (int32 Index = 0; Index < OutResult.Num(); ++Index)
+        {
+            const FStringView PackageName = OutResult.GetPackageName(Index);
+            const FName PackageFName(PackageName.Len(), PackageName.GetData());
+            PackageToEntry.Add(PackageFName, Index);
+            Filter.PackageNames.Add(PackageFName);
+        }
+
+        AssetRegistry.EnumerateAssets(Filter, [&PackageToEntry, &OutResult](const FAssetData& AssetData)
+            {
+                if (const int32* Index = PackageToEntry.Find(AssetData.PackageName))
+                {
+                    OutResult.Entries[*Index].bRegistered = true;
+                }
+                return true;
+            });
+
+        OutResult.bRegistryQueried = true;
+        OutResult.bRegistryComplete = !AssetRegistry.IsLoadingAssets();
+    }
+}
+
+/**
+ * 디렉터리 트리를 스캔하는 함수.
+ * 1) 루트부터 작업 수가 충분해질 때까지 하위 디렉터리를 펼치고, 펼친 단계의 파일은 호출 스레드에서 처리
+ * 2) 남은 하위 트리마다 워커 스레드에서 재귀 순회 및 패키지 이름 변환
+ * 3) 작업별 결과를 하나의 버퍼로 합친 뒤 필요하면 Asset Registry를 한 번에 조회
+ */
+bool FEditorPackageDirectoryScanner::Scan(const FString& RootDirectory, FEditorPackageScanResult& OutResult, bool bQueryRegistry)
+{
+    using namespace EditorPackageDirectoryScanner;
+
+    // -- Asset Registry 조회만 게임 스레드가 필요
+    check(IsInGameThread() || !bQueryRegistry);
+    OutResult.Reset();
+
+    IFileManager& FileManager = IFileManager::Get();
+    const FString FullRootDirectory = FPaths::ConvertRelativePathToFull(RootDirectory);
+    if (!FileManager.DirectoryExists(*FullRootDirectory))
+    {
+        UE_LOG(LogEditorPackageUtils, Warning, TEXT("Scan directory does not exist: %s"), *FullRootDirectory);
+        return false;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // -- 모든 작업이 같은 시점의 스냅샷으로 변환
+    const FEditorPackageMountSnapshotRef MountSnapshot = FEditorPackageMountTable::Get().GetSnapshot();
+
+    // -- 작업 단위가 충분해질 때까지 하위 디렉터리를 펼침
+    const int32 TargetTasks = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1) * TasksPerWorker;
+
+    FTaskOutput SplitOutput;
+    TStringBuilder<512> PackageName;
+    TArray<FString> Frontier;
+    Frontier.Add(FullRootDirectory);
+
+    for (int32 Depth = 0; Depth < MaxSplitDepth && Frontier.Num() > 0 && Frontier.Num() < TargetTasks; ++Depth)
+    {
+        TArray<FString> NextFrontier;
+        for (const FString& Directory : Frontier)
+        {
+            FileManager.IterateDirectory(*Directory, [&NextFrontier, &MountSnapshot, &PackageName, &SplitOutput](const TCHAR* Path, bool bIsDirectory)
+                {
+                    if (bIsDirectory)
+                    {
+                        NextFrontier.Emplace(Path);
+                    }
+                    else
+                    {
+                        AddFile(FStringView(Path), *MountSnapshot, PackageName, SplitOutput);
+                    }
+                    return true;
+                });
+        }
+        Frontier = MoveTemp(NextFrontier);
+    }
+
+    // -- 남은 하위 트리를 워커 스레드에서 순회
+    TArray<FTaskOutput> TaskOutputs;
+    TaskOutputs.SetNum(Frontier.Num());
+
+    ParallelFor(Frontier.Num(), [&Frontier, &TaskOutputs, &MountSnapshot, &FileManager](int32 TaskIndex)
+        {
+            FTaskOutput& Output = TaskOutputs[TaskIndex];
+            TStringBuilder<512> TaskPackageName;
+            FileManager.IterateDirectoryRecursively(*Frontier[TaskIndex], [&Output, &MountSnapshot, &TaskPackageName](const TCHAR* Path, bool bIsDirectory)
+                {
+                    if (!bIsDirectory)
+                    {
+                        AddFile(FStringView(Path), *MountSnapshot, TaskPackageName, Output);
+                    }
+                    return true;
+                });
+        }, Frontier.Num() <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    // -- 결과를 하나의 버퍼로 합침
+    int32 TotalEntries = SplitOutput.Entries.Num();
+    int32 TotalChars = SplitOutput.StringData.Num();
+    for (const FTaskOutput& Output : TaskOutputs)
+    {
+        TotalEntries += Output.Entries.Num();
+        TotalChars += Output.StringData.Num();
+    }
+    OutResult.Entries.Reserve(TotalEntries);
+    OutResult.StringData.Reserve(TotalChars);
+
+    AppendOutput(SplitOutput, OutResult);
+    for (FTaskOutput& Output : TaskOutputs)
+    {
+        AppendOutput(Output, OutResult);
+    }
+
+    if (bQueryRegistry && OutResult.Num() > 0)
+    {
+        QueryRegistry(OutResult);
+    }
+
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("Scanned %d packages under %s in %.1f ms (%d tasks, %d outside content roots)"),
+        OutResult.Num(), *FullRootDirectory, (FPlatformTime::Seconds() - StartTime) * 1000.0, Frontier.Num(), OutResult.NumUnconvertible);
+
+    return true;
+}
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorPackageUtilsTypes.h"
+
+/**
+ * 디렉터리 트리에서 패키지 파일(.uasset, .umap)을 찾아 패키지 이름으로 변환합니다.
+ *
+ * 루트에서 몇 단계까지는 하위 디렉터리를 펼쳐 작업 단위를 만들고, 각 하위 트리를 워커 스레드에서
+ * IterateDirectoryRecursively로 순회합니다. 변환은 스캔 시작 시점의 FEditorPackageMountSnapshot으로 처리하고,
+ * 작업마다 모은 결과는 마지막에 하나의 문자열 버퍼와 항목 배열로 합칩니다.
+ *
+ * @note bQueryRegistry가 true면 게임 스레드에서 호출해야 합니다. false면 어느 스레드에서나 호출할 수 있습니다.
+ */
+class FEditorPackageDirectoryScanner
+{
+public:
+    /**
+     * RootDirectory 아래의 패키지 파일을 모두 찾습니다.
+     *
+     * @param RootDirectory 스캔할 디렉터리. 상대 경로는 절대 경로로 변환됩니다.
+     * @param OutResult 결과. 항목은 디렉터리 순회 순서이며 정렬되어 있지 않습니다.
+     * @param bQueryRegistry true면 찾은 패키지가 Asset Registry에 등록되어 있는지 한 번의 조회로 확인합니다.
+     * @return RootDirectory가 존재하면 true.
+     */
+    static bool Scan(const FString& RootDirectory, FEditorPackageScanResult& OutResult, bool bQueryRegistry);
+};
@@ -0,0 +1,270 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageFingerprintStore.h"
+#include "EditorPackageUtilsLog.h"
+#include "Algo/Sort.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/Paths.h"
+#include "Serialization/ArchiveUObject.h"
+#include "UObject/UObjectHash.h"
+
+namespace EditorPackageFingerprintStore
+{
+    /** 지문 파일 식별자와 형식 버전. 형식이 바뀌면 버전을 올려 이전 파일을 무시합니다. */
+    static constexpr uint32 FileMagic = 0x46555045; // "EPUF"
+    static constexpr int32 FileVersion = 1;
+
+    /**
+     * 직렬화 데이터를 메모리에 모으지 않고 바로 해시하는 아카이브.
+     * 오브젝트 포인터와 이름은 주소나 인덱스 대신 경로 문자열로 해시합니다.
+     */
+    class FContentHashArchive : public FArchiveUObject
+    {
+    public:
+        explicit FContentHashArchive(FXxHash64Builder& InBuilder)
+            : Builder(InBuilder)
+        {
+            SetIsSaving(true);
+            SetIsPersistent(true);
+        }
+
+        virtual FString GetArchiveName() const override { return TEXT("FContentHashArchive"); }
+
+        virtual void Serialize(void* Data, int64 Num) override
+        {
+            Builder.Update(Data, Num);
+        }
+
+        virtual FArchive& operator<<(FName& Value) override
+        {
+            TStringBuilder<FName::StringBufferSize> Name;
+            Value.AppendString(Name);
+            HashString(Name.ToView());
+            return *this;
+        }
+
+        virtual FArchive& operator<<(UObject*& Value) override
+        {
+            TStringBuilder<256> PathName;
+            if (Value)
+            {
+                Value->GetPathName(nullptr, PathName);
+            }
+            HashString(PathName.ToView());
+            return *this;
+        }
+
+        using FArchiveUObject::operator<<;
+
+    private:
+        void HashString(FStringView String)
+        {
+            int32 Len = String.Len();
+            Builder.Update(&Len, sizeof(Len));
+            Builder.Update(String.GetData(), Len * sizeof(TCHAR));
+        }
+
+        FXxHash64Builder& Builder;
+    };
+
+    static FAutoConsoleCommand ClearFingerprintsCommand(
+        TEXT("EditorPackageUtils.ClearFingerprints"),
+        TEXT("저장된 패키지 지문을 모두 지워 다음 저장 시 모든 패키지를 다시 기록하게 합니다."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FEditorPackageFingerprintStore::Get().Clear();
+                FEditorPackageFingerprintStore::Get().Flush();
+            }));
+}
+
+FEditorPackageFingerprintStore& FEditorPackageFingerprintStore::Get()
+{
+    static FEditorPackageFingerprintStore Instance;
+    return Instance;
+}
+
+void FEditorPackageFingerprintStore::Initialize()
+{
+    Load();
+}
+
+void FEditorPackageFingerprintStore::Shutdown()
+{
+    Flush();
+}
+
+FString FEditorPackageFingerprintStore::GetStoreFilename()
+{
+    return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("EditorPackageUtils"), TEXT("PackageFingerprints.bin"));
+}
+
+/**
+ * SaveObject의 내용 해시를 계산하는 함수.
+ * SaveObject와 중첩된 하위 오브젝트를 경로 순으로 정렬해 클래스, 상대 경로, 스크립트 프로퍼티를 차례로 해시합니다.
+ */
+uint64 FEditorPackageFingerprintStore::ComputeContentHash(UObject* SaveObject)
+{
+    check(SaveObject);
+
+    // -- 하위 오브젝트는 해시 테이블 순서로 나오므로 경로로 정렬
+    TArray<UObject*> SubObjects;
+    GetObjectsWithOuter(SaveObject, SubObjects, true);
+
+    TArray<TPair<FString, UObject*>> Objects;
+    Objects.Reserve(SubObjects.Num() + 1);
+    Objects.Emplace(FString(), SaveObject);
+    for (UObject* SubObject : SubObjects)
+    {
+        Objects.Emplace(SubObject->GetPathName(SaveObject), SubObject);
+    }
+    Algo::SortBy(MakeArrayView(Objects).RightChop(1), [](const TPair<FString, UObject*>& Entry) -> const FString& { return Entry.Key; });
+
+    FXxHash64Builder Builder;
+    EditorPackageFingerprintStore::FContentHashArchive Ar(Builder);
+    for (TPair<FString, UObject*>& Entry : Objects)
+    {
+        UClass* Class = Entry.Value->GetClass();
+        UObject* ClassObject = Class;
+        Ar << ClassObject;
+        Ar << Entry.Key;
+        Entry.Value->SerializeScriptProperties(Ar);
+    }
+
+    // -- 0은 "해시 없음"으로 사용하므로 피함
+    const uint64 Hash = Builder.Finalize().Hash;
+    return Hash != 0 ? Hash : 1;
+}
+
+bool FEditorPackageFingerprintStore::IsUnchanged(FName PackageName, const FString& Filename, uint64 ContentHash) const
+{
+    const FFingerprint* Fingerprint = Fingerprints.Find(PackageName);
+    if (!Fingerprint || Fingerprint->ContentHash != ContentHash)
+    {
+        return false;
+    }
+
+    // -- 파일이 지워졌거나 외부에서 바뀐 경우 다시 저장
+    return IFileManager::Get().FileSize(*Filename) == Fingerprint->FileSize;
+}
+
+void FEditorPackageFingerprintStore::Record(FName PackageName, uint64 ContentHash, int64 FileSize)
+{
+    FFingerprint& Fingerprint = Fingerprints.FindOrAdd(PackageName);
+    if (Fingerprint.ContentHash != ContentHash || Fingerprint.FileSize != FileSize)
+    {
+        Fingerprint.ContentHash = ContentHash;
+        Fingerprint.FileSize = FileSize;
+        bDirty = true;
+    }
+}
+
+void FEditorPackageFingerprintStore::Remove(FName PackageName)
+{
+    if (Fingerprints.Remove(PackageName) > 0)
+    {
+        bDirty = true;
+    }
+}
+
+void FEditorPackageFingerprintStore::Clear()
+{
+    if (Fingerprints.Num() > 0)
+    {
+        Fingerprints.Reset();
+        bDirty = true;
+    }
+}
+
+bool FEditorPackageFingerprintStore::Load()
+{
+    Fingerprints.Reset();
+    bDirty = false;
+
+    const FString Filename = GetStoreFilename();
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent));
+    if (!Reader)
+    {
+        return false;
+    }
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    int32 NumEntries = 0;
+    *Reader << Magic << Version << NumEntries;
+    if (Magic != EditorPackageFingerprintStore::FileMagic || Version != EditorPackageFingerprintStore::FileVersion || NumEntries < 0)
+    {
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Ignoring outdated package fingerprint file: %s"), *Filename);
+        return false;
+    }
+
+    Fingerprints.Reserve(NumEntries);
+    for (int32 Index = 0; Index < NumEntries && !Reader->IsError(); ++Index)
+    {
+        FString PackageName;
+        FFingerprint Fingerprint;
+        *Reader << PackageName << Fingerprint.ContentHash << Fingerprint.FileSize;
+        Fingerprints.Add(FName(*PackageName), Fingerprint);
+    }
+
+    if (Reader->IsError())
+    {
+        UE_LOG(LogEditorPackageUtils, Warning, TEXT("Package fingerprint file is corrupt and will be rebuilt: %s"), *Filename);
+        Fingerprints.Reset();
+        return false;
+    }
+
+    UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Loaded %d package fingerprints from %s"), Fingerprints.Num(), *Filename);
+    return true;
+}
+
+/**
+ * 지문을 디스크에 기록하는 함수.
+ * 기록 중에 에디터가 종료되어도 이전 파일이 깨지지 않도록 임시 파일에 쓴 뒤 교체합니다.
+ */
+bool FEditorPackageFingerprintStore::Flush()
+{
+    if (!bDirty)
+    {
+        return true;
+    }
+
+    const FString Filename = GetStoreFilename();
+    const FString TempFilename = Filename + TEXT(".tmp");
+    {
+        TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempFilename));
+        if (!Writer)
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to write package fingerprint file: %s"), *TempFilename);
+            return false;
+        }
+
+        uint32 Magic = EditorPackageFingerprintStore::FileMagic;
+        int32 Version = EditorPackageFingerprintStore::FileVersion;
+        int32 NumEntries = Fingerprints.Num();
+        *Writer << Magic << Version << NumEntries;
+
+        for (TPair<FName, FFingerprint>& Entry : Fingerprints)
+        {
+            FString PackageName = Entry.Key.ToString();
+            *Writer << PackageName << Entry.Value.ContentHash << Entry.Value.FileSize;
+        }
+
+        if (!Writer->Close())
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to write package fingerprint file: %s"), *TempFilename);
+            return false;
+        }
+    }
+
+    if (!IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to replace package fingerprint file: %s"), *Filename);
+        return false;
+    }
+
+    bDirty = false;
+    return true;
+}
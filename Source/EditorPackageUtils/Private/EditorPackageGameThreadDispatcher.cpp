@@ -0,0 +1,154 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageGameThreadDispatcher.h"
+#include "EditorPackageUtils.h"
+#include "EditorPackageUtilsLog.h"
+#include "EditorPackageUtilsStats.h"
+#include "Misc/ScopeLock.h"
+
+FEditorPackageGameThreadDispatcher& FEditorPackageGameThreadDispatcher::Get()
+{
+    static FEditorPackageGameThreadDispatcher Instance;
+    return Instance;
+}
+
+void FEditorPackageGameThreadDispatcher::Initialize()
+{
+    check(IsInGameThread());
+
+    {
+        FScopeLock Lock(&PendingLock);
+        bShutdown = false;
+    }
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEditorPackageGameThreadDispatcher::Tick));
+}
+
+void FEditorPackageGameThreadDispatcher::Shutdown()
+{
+    check(IsInGameThread());
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    TickHandle.Reset();
+
+    // -- 실행 중인 요청이 새 요청을 추가할 수 있으므로 대기열이 빌 때까지 반복
+    while (GetNumPending() > 0)
+    {
+        ProcessPending();
+    }
+
+    FScopeLock Lock(&PendingLock);
+    bShutdown = true;
+}
+
+void FEditorPackageGameThreadDispatcher::EnqueueRequest(TUniqueFunction<void()>&& Request)
+{
+    FScopeLock Lock(&PendingLock);
+    checkf(!bShutdown, TEXT("Game thread request dispatched after EditorPackageUtils shut down"));
+    PendingRequests.Add(MoveTemp(Request));
+}
+
+TFuture<bool> FEditorPackageGameThreadDispatcher::IsAssetRegistered(const FSoftObjectPath& ObjectPath)
+{
+    if (IsInGameThread())
+    {
+        return MakeFulfilledPromise<bool>(EditorPackageUtils::IsAssetRegistered(ObjectPath)).GetFuture();
+    }
+
+    FScopeLock Lock(&PendingLock);
+    checkf(!bShutdown, TEXT("Game thread request dispatched after EditorPackageUtils shut down"));
+
+    FRegistryQuery& Query = PendingRegistryQueries.AddDefaulted_GetRef();
+    Query.ObjectPath = ObjectPath;
+    return Query.Promise.GetFuture();
+}
+
+TFuture<UClass*> FEditorPackageGameThreadDispatcher::ResolveClassDefinition(FName ModuleName, FName ClassName)
+{
+    return Dispatch([ModuleName, ClassName]()
+        {
+            return EditorPackageUtils::ResolveClassDefinition(ModuleName, ClassName);
+        });
+}
+
+TFuture<UScriptStruct*> FEditorPackageGameThreadDispatcher::ResolveStructDefinition(FName ModuleName, FName StructName)
+{
+    return Dispatch([ModuleName, StructName]()
+        {
+            return EditorPackageUtils::ResolveStructDefinition(ModuleName, StructName);
+        });
+}
+
+void FEditorPackageGameThreadDispatcher::Flush()
+{
+    check(IsInGameThread());
+
+    ProcessPending();
+}
+
+int32 FEditorPackageGameThreadDispatcher::GetNumPending() const
+{
+    FScopeLock Lock(&PendingLock);
+    return PendingRequests.Num() + PendingRegistryQueries.Num();
+}
+
+bool FEditorPackageGameThreadDispatcher::Tick(float DeltaTime)
+{
+    ProcessPending();
+    return true;
+}
+
+/**
+ * 대기 중인 요청을 실행하는 함수.
+ * 잠금은 대기열을 꺼내는 동안만 잡으므로, 요청을 실행하는 동안에도 워커 스레드는 다음 틱을 위한 요청을 추가할 수 있습니다.
+ * Asset Registry 조회는 모두 모아 한 번의 AreAssetsRegistered로 처리한 뒤 요청 순서대로 결과를 돌려줍니다.
+ */
+void FEditorPackageGameThreadDispatcher::ProcessPending()
+{
+    check(IsInGameThread());
+
+    TArray<TUniqueFunction<void()>> Requests;
+    TArray<FRegistryQuery> RegistryQueries;
+    {
+        FScopeLock Lock(&PendingLock);
+        Requests = MoveTemp(PendingRequests);
+        RegistryQueries = MoveTemp(PendingRegistryQueries);
+        PendingRequests.Reset();
+        PendingRegistryQueries.Reset();
+    }
+
+    if (Requests.Num() == 0 && RegistryQueries.Num() == 0)
+    {
+        return;
+    }
+
+    EDITORPACKAGEUTILS_SCOPED_STAT(DispatchGameThreadBatch);
+    const double StartTime = FPlatformTime::Seconds();
+
+    // -- Asset Registry 조회를 한 번에 처리
+    if (RegistryQueries.Num() > 0)
+    {
+        TArray<FSoftObjectPath> ObjectPaths;
+        ObjectPaths.Reserve(RegistryQueries.Num());
+        for (const FRegistryQuery& Query : RegistryQueries)
+        {
+            ObjectPaths.Add(Query.ObjectPath);
+        }
+
+        TBitArray<> Registered;
+        EditorPackageUtils::AreAssetsRegistered(ObjectPaths, Registered);
+
+        for (int32 Index = 0; Index < RegistryQueries.Num(); ++Index)
+        {
+            RegistryQueries[Index].Promise.SetValue(Registered[Index]);
+        }
+    }
+
+    for (TUniqueFunction<void()>& Request : Requests)
+    {
+        Request();
+    }
+
+    UE_LOG(LogEditorPackageUtils, VeryVerbose, TEXT("Ran %d game thread requests and %d registry queries in %.2f ms"),
+        Requests.Num(), RegistryQueries.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
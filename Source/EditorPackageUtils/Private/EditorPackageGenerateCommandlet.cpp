@@ -0,0 +1,508 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageGenerateCommandlet.h"
+#include "EditorPackageUtils.h"
+#include "EditorPackageUtilsLog.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataTable.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace EditorPackageGenerate
+{
+    enum class EEntryKind : uint8
+    {
+        /** 클래스 인스턴스 에셋. */
+        Class,
+
+        /** 구조체를 행 구조체로 쓰는 데이터 테이블 에셋. */
+        Struct,
+    };
+
+    /** 매니페스트 항목 하나. */
+    struct FManifestEntry
+    {
+        EEntryKind Kind = EEntryKind::Class;
+        FString Module;
+        FString Type;
+        FString Directory;
+        FString Name;
+
+        /** struct 항목의 행 데이터 파일 (CSV/JSON). */
+        FString Data;
+
+        /** class 항목의 프로퍼티 값. */
+        TSharedPtr<FJsonObject> Properties;
+    };
+
+    struct FFailure
+    {
+        int32 EntryIndex = INDEX_NONE;
+        FString Name;
+        FString Reason;
+    };
+
+    struct FRunStats
+    {
+        int32 NumSaved = 0;
+        int32 NumSkipped = 0;
+        int64 BytesWritten = 0;
+        double ResolveSeconds = 0.0;
+        double CreateSeconds = 0.0;
+        double SaveSeconds = 0.0;
+        double GCSeconds = 0.0;
+        TArray<FFailure> Failures;
+    };
+
+    /** 상대 경로는 프로젝트 디렉터리 기준으로 변환합니다. */
+    static FString ResolvePath(const FString& Path)
+    {
+        return FPaths::IsRelative(Path) ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Path) : Path;
+    }
+
+    static bool ParseKind(const FString& KindString, EEntryKind& OutKind)
+    {
+        if (KindString.Equals(TEXT("class"), ESearchCase::IgnoreCase))
+        {
+            OutKind = EEntryKind::Class;
+            return true;
+        }
+        if (KindString.Equals(TEXT("struct"), ESearchCase::IgnoreCase))
+        {
+            OutKind = EEntryKind::Struct;
+            return true;
+        }
+        return false;
+    }
+
+    static bool ParseJsonManifest(const FString& Text, TArray<FManifestEntry>& OutEntries)
+    {
+        TSharedPtr<FJsonObject> Root;
+        TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(Text);
+        if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Invalid JSON manifest: %s"), *Reader->GetErrorMessage());
+            return false;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* Assets = nullptr;
+        if (!Root->TryGetArrayField(TEXT("assets"), Assets))
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("JSON manifest has no \"assets\" array"));
+            return false;
+        }
+
+        for (int32 Index = 0; Index < Assets->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject> Asset = (*Assets)[Index]->AsObject();
+            if (!Asset.IsValid())
+            {
+                UE_LOG(LogEditorPackageUtils, Error, TEXT("Manifest entry %d is not an object"), Index);
+                return false;
+            }
+
+            FManifestEntry& Entry = OutEntries.AddDefaulted_GetRef();
+            const FString KindString = Asset->GetStringField(TEXT("kind"));
+            if (!ParseKind(KindString, Entry.Kind))
+            {
+                UE_LOG(LogEditorPackageUtils, Error, TEXT("Manifest entry %d has unknown kind: %s"), Index, *KindString);
+                return false;
+            }
+
+            Asset->TryGetStringField(TEXT("module"), Entry.Module);
+            Asset->TryGetStringField(TEXT("type"), Entry.Type);
+            Asset->TryGetStringField(TEXT("directory"), Entry.Directory);
+            Asset->TryGetStringField(TEXT("name"), Entry.Name);
+            Asset->TryGetStringField(TEXT("data"), Entry.Data);
+
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (Asset->TryGetObjectField(TEXT("properties"), Properties))
+            {
+                Entry.Properties = *Properties;
+            }
+        }
+        return true;
+    }
+
+    static bool ParseCsvManifest(const FString& Text, TArray<FManifestEntry>& OutEntries)
+    {
+        TArray<FString> Lines;
+        Text.ParseIntoArrayLines(Lines);
+        if (Lines.Num() == 0)
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("CSV manifest is empty"));
+            return false;
+        }
+
+        // -- 헤더로 열 위치를 찾음
+        TArray<FString> Header;
+        Lines[0].ParseIntoArray(Header, TEXT(","), false);
+        auto FindColumn = [&Header](const TCHAR* Name)
+            {
+                return Header.IndexOfByPredicate([Name](const FString& Column) { return Column.TrimStartAndEnd().Equals(Name, ESearchCase::IgnoreCase); });
+            };
+
+        const int32 KindColumn = FindColumn(TEXT("Kind"));
+        const int32 ModuleColumn = FindColumn(TEXT("Module"));
+        const int32 TypeColumn = FindColumn(TEXT("Type"));
+        const int32 DirectoryColumn = FindColumn(TEXT("Directory"));
+        const int32 NameColumn = FindColumn(TEXT("Name"));
+        const int32 DataColumn = FindColumn(TEXT("Data"));
+        if (KindColumn == INDEX_NONE || ModuleColumn == INDEX_NONE || TypeColumn == INDEX_NONE || DirectoryColumn == INDEX_NONE || NameColumn == INDEX_NONE)
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("CSV manifest header must contain Kind, Module, Type, Directory and Name"));
+            return false;
+        }
+
+        for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+        {
+            TArray<FString> Fields;
+            Lines[LineIndex].ParseIntoArray(Fields, TEXT(","), false);
+            auto GetField = [&Fields](int32 Column)
+                {
+                    return Fields.IsValidIndex(Column) ? Fields[Column].TrimStartAndEnd() : FString();
+                };
+
+            FManifestEntry& Entry = OutEntries.AddDefaulted_GetRef();
+            const FString KindString = GetField(KindColumn);
+            if (!ParseKind(KindString, Entry.Kind))
+            {
+                UE_LOG(LogEditorPackageUtils, Error, TEXT("CSV manifest line %d has unknown kind: %s"), LineIndex + 1, *KindString);
+                return false;
+            }
+
+            Entry.Module = GetField(ModuleColumn);
+            Entry.Type = GetField(TypeColumn);
+            Entry.Directory = GetField(DirectoryColumn);
+            Entry.Name = GetField(NameColumn);
+            Entry.Data = GetField(DataColumn);
+        }
+        return true;
+    }
+
+    static bool LoadManifest(const FString& Filename, TArray<FManifestEntry>& OutEntries)
+    {
+        FString Text;
+        if (!FFileHelper::LoadFileToString(Text, *Filename))
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to read manifest: %s"), *Filename);
+            return false;
+        }
+
+        return FPaths::GetExtension(Filename).Equals(TEXT("csv"), ESearchCase::IgnoreCase)
+            ? ParseCsvManifest(Text, OutEntries)
+            : ParseJsonManifest(Text, OutEntries);
+    }
+
+    /**
+     * 매니페스트 항목의 타입을 찾아 Created 패키지 안에 최종 이름으로 저장할 오브젝트를 만듭니다.
+     *
+     * @param Created CreateAssetPackages로 만든 항목의 패키지.
+     * @param OutError 실패 이유.
+     * @return 만든 오브젝트. 실패하면 nullptr.
+     */
+    static UObject* CreateObject(const FManifestEntry& Entry, const FEditorPackageCreateResult& Created, FRunStats& Stats, FString& OutError)
+    {
+        const EObjectFlags Flags = RF_Public | RF_Standalone;
+
+        if (Entry.Kind == EEntryKind::Class)
+        {
+            double StartTime = FPlatformTime::Seconds();
+            UClass* Class = EditorPackageUtils::LoadClassDefinitionByName(Entry.Module, Entry.Type);
+            Stats.ResolveSeconds += FPlatformTime::Seconds() - StartTime;
+
+            if (!Class)
+            {
+                OutError = FString::Printf(TEXT("Class not found: %s.%s"), *Entry.Module, *Entry.Type);
+                return nullptr;
+            }
+            if (Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+            {
+                OutError = FString::Printf(TEXT("Class cannot be instantiated: %s"), *Class->GetPathName());
+                return nullptr;
+            }
+
+            StartTime = FPlatformTime::Seconds();
+            UObject* Object = EditorPackageUtils::NewAssetInPackage(Created, Class, Flags);
+            if (Entry.Properties.IsValid() && !FJsonObjectConverter::JsonObjectToUStruct(Entry.Properties.ToSharedRef(), Class, Object))
+            {
+                OutError = TEXT("Failed to apply properties");
+                Object->ClearFlags(Flags);
+                Object = nullptr;
+            }
+            Stats.CreateSeconds += FPlatformTime::Seconds() - StartTime;
+            return Object;
+        }
+
+        double StartTime = FPlatformTime::Seconds();
+        UScriptStruct* Struct = EditorPackageUtils::LoadStructDefinitionByName(Entry.Module, Entry.Type);
+        Stats.ResolveSeconds += FPlatformTime::Seconds() - StartTime;
+
+        if (!Struct)
+        {
+            OutError = FString::Printf(TEXT("Struct not found: %s.%s"), *Entry.Module, *Entry.Type);
+            return nullptr;
+        }
+
+        StartTime = FPlatformTime::Seconds();
+        UDataTable* DataTable = EditorPackageUtils::NewAssetInPackage<UDataTable>(Created, Flags);
+        DataTable->RowStruct = Struct;
+
+        if (!Entry.Data.IsEmpty())
+        {
+            const FString DataFilename = ResolvePath(Entry.Data);
+            FString DataText;
+            TArray<FString> Problems;
+            if (!FFileHelper::LoadFileToString(DataText, *DataFilename))
+            {
+                Problems.Add(FString::Printf(TEXT("Failed to read data file: %s"), *DataFilename));
+            }
+            else if (FPaths::GetExtension(DataFilename).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+            {
+                Problems = DataTable->CreateTableFromJSONString(DataText);
+            }
+            else
+            {
+                Problems = DataTable->CreateTableFromCSVString(DataText);
+            }
+
+            if (Problems.Num() > 0)
+            {
+                OutError = FString::Join(Problems, TEXT("; "));
+                DataTable->ClearFlags(Flags);
+                DataTable = nullptr;
+            }
+        }
+        Stats.CreateSeconds += FPlatformTime::Seconds() - StartTime;
+        return DataTable;
+    }
+
+    /** 저장이 끝난 오브젝트를 GC 대상으로 돌립니다. */
+    static void ReleaseObjects(TArray<UObject*>& Objects, FRunStats& Stats)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        for (UObject* Object : Objects)
+        {
+            if (UPackage* Package = Object->GetPackage())
+            {
+                Package->ClearFlags(RF_Standalone);
+            }
+            Object->ClearFlags(RF_Standalone);
+        }
+        Objects.Reset();
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        Stats.GCSeconds += FPlatformTime::Seconds() - StartTime;
+    }
+
+    static void AddFailure(FRunStats& Stats, int32 EntryIndex, const FManifestEntry& Entry, const FString& Reason)
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Entry %d (%s): %s"), EntryIndex, *Entry.Name, *Reason);
+
+        FFailure& Failure = Stats.Failures.AddDefaulted_GetRef();
+        Failure.EntryIndex = EntryIndex;
+        Failure.Name = Entry.Name;
+        Failure.Reason = Reason;
+    }
+
+    static bool WriteReport(const FString& Filename, const FString& ManifestFilename, int32 NumEntries, const FRunStats& Stats, double TotalSeconds)
+    {
+        FString Json;
+        TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("formatVersion"), 1);
+        Writer->WriteValue(TEXT("manifest"), ManifestFilename);
+        Writer->WriteValue(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+        Writer->WriteValue(TEXT("entries"), NumEntries);
+        Writer->WriteValue(TEXT("saved"), Stats.NumSaved);
+        Writer->WriteValue(TEXT("skipped"), Stats.NumSkipped);
+        Writer->WriteValue(TEXT("failed"), Stats.Failures.Num());
+        Writer->WriteValue(TEXT("bytesWritten"), Stats.BytesWritten);
+        Writer->WriteValue(TEXT("totalMs"), TotalSeconds * 1000.0);
+        Writer->WriteValue(TEXT("assetsPerSecond"), TotalSeconds > 0.0 ? (Stats.NumSaved + Stats.NumSkipped) / TotalSeconds : 0.0);
+
+        Writer->WriteObjectStart(TEXT("phases"));
+        Writer->WriteValue(TEXT("resolveMs"), Stats.ResolveSeconds * 1000.0);
+        Writer->WriteValue(TEXT("createMs"), Stats.CreateSeconds * 1000.0);
+        Writer->WriteValue(TEXT("saveMs"), Stats.SaveSeconds * 1000.0);
+        Writer->WriteValue(TEXT("gcMs"), Stats.GCSeconds * 1000.0);
+        Writer->WriteObjectEnd();
+
+        Writer->WriteArrayStart(TEXT("failures"));
+        for (const FFailure& Failure : Stats.Failures)
+        {
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("index"), Failure.EntryIndex);
+            Writer->WriteValue(TEXT("name"), Failure.Name);
+            Writer->WriteValue(TEXT("reason"), Failure.Reason);
+            Writer->WriteObjectEnd();
+        }
+        Writer->WriteArrayEnd();
+
+        Writer->WriteObjectEnd();
+        Writer->Close();
+
+        return FFileHelper::SaveStringToFile(Json, *Filename);
+    }
+}
+
+UEditorPackageGenerateCommandlet::UEditorPackageGenerateCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 UEditorPackageGenerateCommandlet::Main(const FString& Params)
+{
+    using namespace EditorPackageGenerate;
+
+    // -- 인자 처리
+    FString ManifestFilename;
+    if (!FParse::Value(*Params, TEXT("Manifest="), ManifestFilename))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Usage: -run=EditorPackageGenerate -Manifest=<Filename> [-BatchSize=64] [-OnlyIfChanged] [-Report=<Filename>]"));
+        return 1;
+    }
+    ManifestFilename = ResolvePath(ManifestFilename);
+
+    int32 BatchSize = 64;
+    FParse::Value(*Params, TEXT("BatchSize="), BatchSize);
+    BatchSize = FMath::Max(BatchSize, 1);
+
+    const EEditorPackageSaveMode SaveMode = FParse::Param(*Params, TEXT("OnlyIfChanged")) ? EEditorPackageSaveMode::OnlyIfChanged : EEditorPackageSaveMode::Always;
+
+    FString ReportFilename = FPaths::Combine(FPaths::ProjectLogDir(), TEXT("EditorPackageGenerate.json"));
+    FParse::Value(*Params, TEXT("Report="), ReportFilename);
+
+    TArray<FManifestEntry> Entries;
+    if (!LoadManifest(ManifestFilename, Entries))
+    {
+        return 1;
+    }
+
+    UE_LOG(LogEditorPackageUtils, Display, TEXT("Generating %d assets from %s (batch size %d)"), Entries.Num(), *ManifestFilename, BatchSize);
+
+    // -- 배치 단위로 생성 및 저장
+    FRunStats Stats;
+    const double StartTime = FPlatformTime::Seconds();
+
+    for (int32 BatchStart = 0; BatchStart < Entries.Num(); BatchStart += BatchSize)
+    {
+        const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Entries.Num());
+
+        // -- 배치의 패키지를 한 번에 만들어 오브젝트를 처음부터 최종 패키지와 이름으로 생성
+        TArray<FEditorPackageCreateItem> CreateItems;
+        TArray<int32> CreateEntries;
+        for (int32 EntryIndex = BatchStart; EntryIndex < BatchEnd; ++EntryIndex)
+        {
+            const FManifestEntry& Entry = Entries[EntryIndex];
+            if (Entry.Name.IsEmpty() || Entry.Directory.IsEmpty())
+            {
+                AddFailure(Stats, EntryIndex, Entry, TEXT("Missing name or directory"));
+                continue;
+            }
+
+            FEditorPackageCreateItem& CreateItem = CreateItems.AddDefaulted_GetRef();
+            CreateItem.SaveDirectory = ResolvePath(Entry.Directory);
+            CreateItem.FileName = Entry.Name;
+            CreateEntries.Add(EntryIndex);
+        }
+
+        const double CreatePackagesStartTime = FPlatformTime::Seconds();
+        TArray<FEditorPackageCreateResult> CreateResults;
+        EditorPackageUtils::CreateAssetPackages(CreateItems, CreateResults);
+        Stats.CreateSeconds += FPlatformTime::Seconds() - CreatePackagesStartTime;
+
+        TArray<FEditorPackageSaveItem> Items;
+        TArray<int32> ItemEntries;
+        TArray<UObject*> Objects;
+
+        for (int32 CreateIndex = 0; CreateIndex < CreateResults.Num(); ++CreateIndex)
+        {
+            const int32 EntryIndex = CreateEntries[CreateIndex];
+            const FManifestEntry& Entry = Entries[EntryIndex];
+            const FEditorPackageCreateResult& Created = CreateResults[CreateIndex];
+            if (!Created.Package)
+            {
+                AddFailure(Stats, EntryIndex, Entry, TEXT("Failed to create package"));
+                continue;
+            }
+
+            FString Error;
+            UObject* Object = CreateObject(Entry, Created, Stats, Error);
+            if (!Object)
+            {
+                AddFailure(Stats, EntryIndex, Entry, Error);
+                continue;
+            }
+
+            FEditorPackageSaveItem& Item = Items.AddDefaulted_GetRef();
+            Item.Object = Object;
+            Item.SaveDirectory = CreateItems[CreateIndex].SaveDirectory;
+            Item.FileName = Entry.Name;
+            ItemEntries.Add(EntryIndex);
+            Objects.Add(Object);
+        }
+
+        if (Items.Num() > 0)
+        {
+            const double SaveStartTime = FPlatformTime::Seconds();
+            const TArray<FEditorPackageSaveResult> Results = EditorPackageUtils::SaveAssetsToPackages(Items, SaveMode);
+            Stats.SaveSeconds += FPlatformTime::Seconds() - SaveStartTime;
+
+            for (int32 ItemIndex = 0; ItemIndex < Results.Num(); ++ItemIndex)
+            {
+                const FEditorPackageSaveResult& Result = Results[ItemIndex];
+                if (!Result.bSuccess)
+                {
+                    AddFailure(Stats, ItemEntries[ItemIndex], Entries[ItemEntries[ItemIndex]], TEXT("Save failed"));
+                }
+                else if (Result.bSkipped)
+                {
+                    ++Stats.NumSkipped;
+                }
+                else
+                {
+                    ++Stats.NumSaved;
+                    Stats.BytesWritten += Result.FileSize;
+                }
+            }
+        }
+
+        ReleaseObjects(Objects, Stats);
+
+        const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+        UE_LOG(LogEditorPackageUtils, Display, TEXT("[%d/%d] %d saved, %d skipped, %d failed (%.1f assets/s)"),
+            BatchEnd, Entries.Num(), Stats.NumSaved, Stats.NumSkipped, Stats.Failures.Num(),
+            ElapsedSeconds > 0.0 ? BatchEnd / ElapsedSeconds : 0.0);
+    }
+
+    // -- 결과 보고
+    const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+    UE_LOG(LogEditorPackageUtils, Display, TEXT("Generated %d assets in %.2f s: %d saved, %d skipped, %d failed, %.2f MB written (%.1f assets/s, %.2f MB/s)"),
+        Entries.Num(), TotalSeconds, Stats.NumSaved, Stats.NumSkipped, Stats.Failures.Num(), Stats.BytesWritten / (1024.0 * 1024.0),
+        TotalSeconds > 0.0 ? (Stats.NumSaved + Stats.NumSkipped) / TotalSeconds : 0.0,
+        TotalSeconds > 0.0 ? Stats.BytesWritten / (1024.0 * 1024.0) / TotalSeconds : 0.0);
+    UE_LOG(LogEditorPackageUtils, Display, TEXT("  resolve %.1f ms, create %.1f ms, save %.1f ms, gc %.1f ms"),
+        Stats.ResolveSeconds * 1000.0, Stats.CreateSeconds * 1000.0, Stats.SaveSeconds * 1000.0, Stats.GCSeconds * 1000.0);
+
+    if (!WriteReport(ReportFilename, ManifestFilename, Entries.Num(), Stats, TotalSeconds))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to write generation report: %s"), *ReportFilename);
+        return 1;
+    }
+    UE_LOG(LogEditorPackageUtils, Display, TEXT("Wrote generation report to %s"), *ReportFilename);
+
+    return Stats.Failures.Num() > 0 ? 1 : 0;
+}
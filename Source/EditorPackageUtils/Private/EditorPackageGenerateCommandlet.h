@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EditorPackageGenerateCommandlet.generated.h"
+
+/**
+ * 매니페스트에 적힌 에셋을 에디터 UI 없이 생성하는 커맨드렛.
+ *
+ * 매니페스트의 항목마다 타입을 LoadClassDefinitionByName / LoadStructDefinitionByName으로 찾아 오브젝트를 만들고,
+ * BatchSize개씩 모아 SaveAssetsToPackages로 저장합니다. 배치가 끝날 때마다 저장한 오브젝트를 해제해 메모리를 유지합니다.
+ * - class 항목: 해당 클래스의 인스턴스. "properties"가 있으면 JSON 값으로 프로퍼티를 채웁니다.
+ * - struct 항목: 해당 구조체를 행 구조체로 쓰는 UDataTable. "data"에 CSV/JSON 파일이 있으면 행을 가져옵니다.
+ *
+ * 사용법:
+ *   UnrealEditor-Cmd <Project>.uproject -run=EditorPackageGenerate -Manifest=<Filename> -nullrhi -unattended [옵션]
+ *
+ * 매니페스트 (JSON):
+ *   { "assets": [ { "kind": "class", "module": "MyGame", "type": "MyDataAsset", "directory": "Content/Generated", "name": "DA_Foo",
+ *                   "properties": { "Value": 1 } },
+ *                 { "kind": "struct", "module": "MyGame", "type": "MyRow", "directory": "Content/Generated", "name": "DT_Foo",
+ *                   "data": "Data/Foo.csv" } ] }
+ *
+ * 매니페스트 (CSV, 첫 줄은 헤더, 따옴표로 묶은 필드는 지원하지 않음):
+ *   Kind,Module,Type,Directory,Name,Data
+ *   class,MyGame,MyDataAsset,Content/Generated,DA_Foo,
+ *
+ * 상대 경로(directory, data)는 프로젝트 디렉터리 기준입니다.
+ *
+ * 옵션:
+ *   -Manifest=<Filename>  매니페스트 경로 (.json 또는 .csv)
+ *   -BatchSize=64         한 번에 저장할 에셋 수
+ *   -OnlyIfChanged        내용이 마지막 저장 때와 같은 에셋은 기록하지 않습니다.
+ *   -Report=<Filename>    결과 JSON 경로 (기본: Saved/Logs/EditorPackageGenerate.json)
+ *
+ * 하나라도 실패하면 1을 반환합니다.
+ */
+UCLASS()
+class UEditorPackageGenerateCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UEditorPackageGenerateCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
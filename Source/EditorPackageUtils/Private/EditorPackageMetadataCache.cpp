@@ -0,0 +1,287 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageMetadataCache.h"
+#include "EditorPackageBuildRunner.h"
+#include "EditorPackageTypeCache.h"
+#include "EditorPackageUtilsLog.h"
+#include "Algo/Sort.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+
+namespace EditorPackageMetadataCache
+{
+    /** 캐시 파일 식별자와 형식 버전. 형식이 바뀌면 버전을 올려 이전 파일을 무시합니다. */
+    static constexpr uint32 FileMagic = 0x4D555045; // "EPUM"
+    static constexpr int32 FileVersion = 1;
+
+    /** 손상된 파일로 큰 배열을 할당하지 않도록 하는 항목 수 상한. */
+    static constexpr int32 MaxEntries = 1 << 20;
+
+    static void HashString(FXxHash64Builder& Builder, FStringView String)
+    {
+        const int32 Len = String.Len();
+        Builder.Update(&Len, sizeof(Len));
+        Builder.Update(String.GetData(), Len * sizeof(TCHAR));
+    }
+
+    static FAutoConsoleCommand ClearMetadataCacheCommand(
+        TEXT("EditorPackageUtils.ClearMetadataCache"),
+        TEXT("마운트 테이블과 타입 조회 결과 캐시 파일을 지우고 다음 세션에서 다시 만들게 합니다."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FEditorPackageMetadataCache::Get().Clear();
+            }));
+}
+
+FEditorPackageMetadataCache& FEditorPackageMetadataCache::Get()
+{
+    static FEditorPackageMetadataCache Instance;
+    return Instance;
+}
+
+void FEditorPackageMetadataCache::Initialize()
+{
+    Load();
+
+    EngineLoopInitCompleteHandle = FCoreDelegates::OnFEngineLoopInitComplete.AddRaw(this, &FEditorPackageMetadataCache::OnEngineLoopInitComplete);
+}
+
+void FEditorPackageMetadataCache::Shutdown()
+{
+    FCoreDelegates::OnFEngineLoopInitComplete.Remove(EngineLoopInitCompleteHandle);
+    EngineLoopInitCompleteHandle.Reset();
+
+    Save();
+
+    CapturedRoots.Empty();
+    bRootsCaptured = false;
+}
+
+void FEditorPackageMetadataCache::Clear()
+{
+    IFileManager::Get().Delete(*GetCacheFilename(), false, true, true);
+    bDisabled = true;
+}
+
+FString FEditorPackageMetadataCache::GetCacheFilename()
+{
+    return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("EditorPackageUtils"), TEXT("MetadataCache.bin"));
+}
+
+/**
+ * 현재 세션의 검증 키를 계산하는 함수.
+ * 엔진 바이너리는 엔진/빌드 버전으로, 프로젝트와 프로젝트 플러그인 바이너리는 FEditorPackageBuildRunner의 바이너리 지문으로 구분합니다.
+ */
+uint64 FEditorPackageMetadataCache::ComputeValidationKey(uint64 BinaryFingerprint)
+{
+    using namespace EditorPackageMetadataCache;
+
+    FXxHash64Builder Builder;
+    HashString(Builder, FEngineVersion::Current().ToString());
+    HashString(Builder, FApp::GetBuildVersion());
+    HashString(Builder, FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()));
+
+    Builder.Update(&BinaryFingerprint, sizeof(BinaryFingerprint));
+
+    TArray<TSharedRef<IPlugin>> Plugins = IPluginManager::Get().GetEnabledPlugins();
+    Algo::SortBy(Plugins, [](const TSharedRef<IPlugin>& Plugin) { return Plugin->GetName(); });
+    for (const TSharedRef<IPlugin>& Plugin : Plugins)
+    {
+        HashString(Builder, Plugin->GetName());
+        HashString(Builder, Plugin->GetBaseDir());
+        HashString(Builder, Plugin->GetDescriptor().VersionName);
+    }
+
+    return Builder.Finalize().Hash;
+}
+
+/**
+ * 캐시 파일을 메모리 매핑으로 읽는 함수.
+ * 파일 전체를 복사하지 않고 매핑된 영역에서 바로 역직렬화하며, 검증 키가 다르거나 파일이 손상되었으면 아무것도 복원하지 않습니다.
+ */
+bool FEditorPackageMetadataCache::Load()
+{
+    using namespace EditorPackageMetadataCache;
+
+    const double StartTime = FPlatformTime::Seconds();
+    const FString Filename = GetCacheFilename();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*Filename))
+    {
+        return false;
+    }
+
+    TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*Filename));
+    if (!MappedFile || MappedFile->GetFileSize() <= 0 || MappedFile->GetFileSize() > MAX_int32)
+    {
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Could not map metadata cache: %s"), *Filename);
+        return false;
+    }
+
+    TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+    if (!MappedRegion)
+    {
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Could not map metadata cache: %s"), *Filename);
+        return false;
+    }
+
+    FMemoryReaderView Reader(TArrayView<const uint8>(MappedRegion->GetMappedPtr(), (int32)MappedRegion->GetMappedSize()));
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    uint64 ValidationKey = 0;
+    Reader << Magic << Version << ValidationKey;
+    if (Reader.IsError() || Magic != FileMagic || Version != FileVersion)
+    {
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Ignoring outdated metadata cache: %s"), *Filename);
+        return false;
+    }
+    if (ValidationKey != ComputeValidationKey(FEditorPackageBuildRunner::ComputeBinaryFingerprint()))
+    {
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Metadata cache was written for different binaries or plugins and will be rebuilt"));
+        return false;
+    }
+
+    // -- 마운트 루트
+    int32 NumRoots = 0;
+    Reader << NumRoots;
+    if (NumRoots < 0 || NumRoots > MaxEntries)
+    {
+        Reader.SetError();
+    }
+
+    TArray<FEditorPackageMountTable::FMountRoot> Roots;
+    Roots.SetNum(Reader.IsError() ? 0 : NumRoots);
+    for (FEditorPackageMountTable::FMountRoot& Root : Roots)
+    {
+        Reader << Root.RootName << Root.ContentDir;
+    }
+
+    // -- 타입 조회 결과
+    int32 NumTypes = 0;
+    Reader << NumTypes;
+    if (NumTypes < 0 || NumTypes > MaxEntries)
+    {
+        Reader.SetError();
+    }
+
+    TArray<FEditorPackageTypeCache::FPersistedEntry> Types;
+    Types.SetNum(Reader.IsError() ? 0 : NumTypes);
+    for (FEditorPackageTypeCache::FPersistedEntry& Type : Types)
+    {
+        FString ModuleName;
+        FString TypeName;
+        Reader << Type.bIsClass << ModuleName << TypeName << Type.Path;
+        Type.ModuleName = FName(*ModuleName);
+        Type.TypeName = FName(*TypeName);
+    }
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogEditorPackageUtils, Warning, TEXT("Metadata cache is corrupt and will be rebuilt: %s"), *Filename);
+        return false;
+    }
+
+    FEditorPackageMountTable::Get().SetRoots(MoveTemp(Roots));
+    FEditorPackageTypeCache::Get().ImportEntries(Types);
+
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("Loaded metadata cache (%d content roots, %d types) in %.2f ms"),
+        NumRoots, NumTypes, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return true;
+}
+
+/**
+ * 캐시 파일을 기록하는 함수.
+ * 기록 중에 에디터가 종료되어도 이전 파일이 깨지지 않도록 임시 파일에 쓴 뒤 교체합니다.
+ */
+bool FEditorPackageMetadataCache::Save()
+{
+    using namespace EditorPackageMetadataCache;
+
+    if (bDisabled)
+    {
+        return true;
+    }
+
+    // -- 커맨드렛은 엔진 초기화 완료 이벤트가 없으므로 지금 상태를 기록
+    if (!bRootsCaptured)
+    {
+        OnEngineLoopInitComplete();
+    }
+
+    TArray<FEditorPackageTypeCache::FPersistedEntry> Types;
+    FEditorPackageTypeCache::Get().ExportEntries(Types);
+
+    const FString Filename = GetCacheFilename();
+    const FString TempFilename = Filename + TEXT(".tmp");
+    {
+        TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempFilename));
+        if (!Writer)
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to write metadata cache: %s"), *TempFilename);
+            return false;
+        }
+
+        uint32 Magic = FileMagic;
+        int32 Version = FileVersion;
+        // -- 세션 도중 빌드가 있었어도 기록한 내용은 이 세션이 로드한 바이너리 기준
+        uint64 BinaryFingerprint = FEditorPackageBuildRunner::Get().GetSessionBinaryFingerprint();
+        if (BinaryFingerprint == 0)
+        {
+            BinaryFingerprint = FEditorPackageBuildRunner::ComputeBinaryFingerprint();
+        }
+        uint64 ValidationKey = ComputeValidationKey(BinaryFingerprint);
+        *Writer << Magic << Version << ValidationKey;
+
+        int32 NumRoots = CapturedRoots.Num();
+        *Writer << NumRoots;
+        for (FEditorPackageMountTable::FMountRoot& Root : CapturedRoots)
+        {
+            *Writer << Root.RootName << Root.ContentDir;
+        }
+
+        int32 NumTypes = Types.Num();
+        *Writer << NumTypes;
+        for (FEditorPackageTypeCache::FPersistedEntry& Type : Types)
+        {
+            FString ModuleName = Type.ModuleName.ToString();
+            FString TypeName = Type.TypeName.ToString();
+            *Writer << Type.bIsClass << ModuleName << TypeName << Type.Path;
+        }
+
+        if (!Writer->Close())
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to write metadata cache: %s"), *TempFilename);
+            return false;
+        }
+    }
+
+    if (!IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to replace metadata cache: %s"), *Filename);
+        return false;
+    }
+
+    UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Wrote metadata cache (%d content roots, %d types) to %s"), CapturedRoots.Num(), Types.Num(), *Filename);
+    return true;
+}
+
+void FEditorPackageMetadataCache::OnEngineLoopInitComplete()
+{
+    // -- 종료 중에는 플러그인 콘텐츠가 언마운트되므로 초기화 직후의 완전한 테이블을 보관
+    FEditorPackageMountTable& MountTable = FEditorPackageMountTable::Get();
+    MountTable.EnsureBuilt();
+    CapturedRoots = MountTable.GetRoots();
+    bRootsCaptured = true;
+}
@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorPackageMountTable.h"
+
+/**
+ * 마운트 테이블과 타입 조회 결과를 에디터 재시작 후에도 쓸 수 있도록 디스크에 보관하는 캐시.
+ *
+ * 캐시 파일(Intermediate/EditorPackageUtils/MetadataCache.bin)은 메모리 매핑으로 읽으며,
+ * 다음 값으로 만든 검증 키가 현재 세션과 다르면 무시합니다.
+ * - 엔진 버전과 빌드 버전, 프로젝트 경로
+ * - 활성화된 플러그인 목록 (이름, 경로, 버전)
+ * - 프로젝트와 프로젝트 플러그인의 바이너리 지문 (모듈 바이너리와 *.modules 매니페스트의 수정 시각, 크기)
+ *
+ * 마운트 테이블은 엔진 초기화가 끝난 시점(커맨드렛에서는 종료 시점)의 상태를, 타입 조회 결과는 종료 시점의 상태를 기록합니다.
+ *
+ * 콘솔 명령:
+ *   EditorPackageUtils.ClearMetadataCache  - 캐시 파일을 지우고 다음 세션에서 다시 만들게 합니다.
+ *
+ * @note 게임 스레드에서만 사용해야 합니다.
+ */
+class FEditorPackageMetadataCache
+{
+public:
+    static FEditorPackageMetadataCache& Get();
+
+    /** 캐시 파일을 읽어 검증에 성공하면 마운트 테이블과 타입 캐시에 복원합니다. 두 객체의 Initialize보다 먼저 호출해야 합니다. */
+    void Initialize();
+
+    /** 현재 상태를 캐시 파일에 기록합니다. 타입 캐시와 마운트 테이블의 Shutdown보다 먼저 호출해야 합니다. */
+    void Shutdown();
+
+    /** 캐시 파일을 지우고 이번 세션에는 기록하지 않습니다. */
+    void Clear();
+
+    static FString GetCacheFilename();
+
+private:
+    /** BinaryFingerprint 바이너리를 로드한 세션의 검증 키를 계산합니다. */
+    static uint64 ComputeValidationKey(uint64 BinaryFingerprint);
+
+    bool Load();
+    bool Save();
+
+    void OnEngineLoopInitComplete();
+
+    /** 엔진 초기화가 끝난 시점의 마운트 루트. */
+    TArray<FEditorPackageMountTable::FMountRoot> CapturedRoots;
+    bool bRootsCaptured = false;
+
+    bool bDisabled = false;
+
+    FDelegateHandle EngineLoopInitCompleteHandle;
+};
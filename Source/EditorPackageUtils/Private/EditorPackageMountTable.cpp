@@ -0,0 +1,516 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageMountTable.h"
+#include "EditorPackageUtilsLog.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/PathViews.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/StringBuilder.h"
+#include <atomic>
+
+namespace EditorPackageMountTable
+{
+    constexpr uint32 HashSeed = 2166136261u;
+
+    /** 대소문자와 구분자를 무시하도록 문자를 정규화합니다. */
+    FORCEINLINE TCHAR NormalizeChar(TCHAR C)
+    {
+        return C == TEXT('\\') ? TEXT('/') : FChar::ToLower(C);
+    }
+
+    /** FNV-1a 방식으로 정규화된 문자를 누적합니다. */
+    FORCEINLINE uint32 HashChar(uint32 Hash, TCHAR C)
+    {
+        return (Hash ^ static_cast<uint32>(NormalizeChar(C))) * 16777619u;
+    }
+
+    FORCEINLINE bool IsSeparator(TCHAR C)
+    {
+        return C == TEXT('/') || C == TEXT('\\');
+    }
+
+    /** 정규화된 문자열 전체의 해시. */
+    FORCEINLINE uint32 HashString(FStringView String)
+    {
+        uint32 Hash = HashSeed;
+        for (int32 Index = 0; Index < String.Len(); ++Index)
+        {
+            Hash = HashChar(Hash, String[Index]);
+        }
+        return Hash;
+    }
+
+    /** "/RootName/" 형식의 마운트 포인트에서 앞뒤 '/'를 제거합니다. */
+    FString TrimRootPath(const FString& RootPath)
+    {
+        FString RootName = RootPath;
+        RootName.RemoveFromStart(TEXT("/"));
+        RootName.RemoveFromEnd(TEXT("/"));
+        return RootName;
+    }
+
+    /** 대량 변환에서 한 작업 단위로 처리할 항목 수. 이보다 적으면 호출 스레드에서 처리합니다. */
+    constexpr int32 BulkBatchSize = 1024;
+
+    /** 절대 경로, '/' 구분자, 끝 '/' 없는 형태로 디렉터리 경로를 정규화합니다. */
+    FString NormalizeContentDir(const FString& ContentDir)
+    {
+        FString Result = FPaths::ConvertRelativePathToFull(ContentDir);
+        FPaths::NormalizeDirectoryName(Result);
+        return Result;
+    }
+}
+
+FEditorPackageMountSnapshot::FEditorPackageMountSnapshot(TArray<FEditorPackageMountRoot> InRoots)
+    : Roots(MoveTemp(InRoots))
+{
+    for (int32 RootIndex = 0; RootIndex < Roots.Num(); ++RootIndex)
+    {
+        const FString& ContentDir = Roots[RootIndex].ContentDir;
+
+        PrefixHashToRoot.Add(EditorPackageMountTable::HashString(ContentDir), RootIndex);
+        NameHashToRoot.Add(EditorPackageMountTable::HashString(Roots[RootIndex].RootName), RootIndex);
+        MaxContentDirLen = FMath::Max(MaxContentDirLen, ContentDir.Len());
+    }
+}
+
+/**
+ * 파일 시스템 경로가 속한 콘텐츠 루트를 찾는 함수.
+ * 경로를 앞에서부터 한 번만 훑으며 정규화된 문자의 해시를 누적하고,
+ * 디렉터리 경계('/' 또는 경로 끝)마다 해당 접두사와 같은 해시를 가진 루트가 있는지 확인합니다.
+ * 해시가 일치한 경우에만 실제 문자열을 비교하므로 평균적으로 경로 길이에 비례하는 시간이 걸립니다.
+ */
+bool FEditorPackageMountSnapshot::FindPackageRoot(FStringView FilePath, FStringView& OutRootName, FStringView& OutRelativePath) const
+{
+    using namespace EditorPackageMountTable;
+
+    const int32 ScanLen = FMath::Min(FilePath.Len(), MaxContentDirLen);
+    int32 MatchedRoot = INDEX_NONE;
+    int32 MatchedLen = 0;
+
+    auto TryMatch = [this, FilePath, &MatchedRoot, &MatchedLen](uint32 PrefixHash, int32 PrefixLen)
+    {
+        const FStringView Prefix = FilePath.Left(PrefixLen);
+        for (auto It = PrefixHashToRoot.CreateConstKeyIterator(PrefixHash); It; ++It)
+        {
+            if (ContentDirEquals(Prefix, Roots[It.Value()].ContentDir))
+            {
+                MatchedRoot = It.Value();
+                MatchedLen = PrefixLen;
+                return;
+            }
+        }
+    };
+
+    // -- 디렉터리 경계(구분자 또는 경로 끝)마다 지금까지의 접두사를 확인
+    uint32 Hash = HashSeed;
+    for (int32 Index = 0; Index <= ScanLen; ++Index)
+    {
+        const bool bAtEnd = Index == FilePath.Len();
+        if (Index > 0 && (bAtEnd || IsSeparator(FilePath[Index])))
+        {
+            TryMatch(Hash, Index);
+        }
+        if (Index < ScanLen)
+        {
+            Hash = HashChar(Hash, FilePath[Index]);
+        }
+    }
+
+    if (MatchedRoot == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // -- 루트 이후의 앞쪽 구분자 제거
+    int32 RelativeStart = MatchedLen;
+    while (RelativeStart < FilePath.Len() && IsSeparator(FilePath[RelativeStart]))
+    {
+        ++RelativeStart;
+    }
+
+    OutRootName = Roots[MatchedRoot].RootName;
+    OutRelativePath = FilePath.RightChop(RelativeStart);
+    return true;
+}
+
+bool FEditorPackageMountSnapshot::FindContentDir(FStringView PackageName, FStringView& OutContentDir, FStringView& OutRelativePath) const
+{
+    // -- "/RootName/RelativePath" 형식만 처리
+    int32 SlashIndex;
+    if (PackageName.Len() < 2 || PackageName[0] != TEXT('/') || !PackageName.RightChop(1).FindChar(TEXT('/'), SlashIndex))
+    {
+        return false;
+    }
+
+    const FEditorPackageMountRoot* Root = FindRootByName(PackageName.Mid(1, SlashIndex));
+    if (!Root)
+    {
+        return false;
+    }
+
+    OutContentDir = Root->ContentDir;
+    OutRelativePath = PackageName.RightChop(SlashIndex + 2);
+    return true;
+}
+
+bool FEditorPackageMountSnapshot::TryConvertFilenameToPackageName(FStringView Filename, FStringBuilderBase& OutPackageName) const
+{
+    // -- 상대 경로는 절대 경로로 변환한 뒤 조회
+    FString FullFilename;
+    FStringView LookupPath = Filename;
+    if (FPathViews::IsRelativePath(Filename))
+    {
+        FullFilename = FPaths::ConvertRelativePathToFull(FString(Filename));
+        LookupPath = FullFilename;
+    }
+
+    FStringView RootName;
+    FStringView RelativePath;
+    if (!FindPackageRoot(LookupPath, RootName, RelativePath))
+    {
+        return false;
+    }
+
+    // -- Unreal 경로로 변환 ("/RootName/RelativePath")
+    const int32 RelativeStart = OutPackageName.Len() + RootName.Len() + 2;
+    OutPackageName << TEXT('/') << RootName << TEXT('/') << RelativePath;
+    for (int32 Index = RelativeStart; Index < OutPackageName.Len(); ++Index)
+    {
+        if (OutPackageName.GetData()[Index] == TEXT('\\'))
+        {
+            OutPackageName.GetData()[Index] = TEXT('/');
+        }
+    }
+    return true;
+}
+
+bool FEditorPackageMountSnapshot::TryConvertPackageNameToFilename(FStringView PackageName, FStringBuilderBase& OutFilename, FStringView Extension) const
+{
+    FStringView ContentDir;
+    FStringView RelativePath;
+    if (!FindContentDir(PackageName, ContentDir, RelativePath))
+    {
+        return false;
+    }
+
+    OutFilename << ContentDir << TEXT('/') << RelativePath << Extension;
+    return true;
+}
+
+const FEditorPackageMountRoot* FEditorPackageMountSnapshot::FindRootByName(FStringView RootName) const
+{
+    for (auto It = NameHashToRoot.CreateConstKeyIterator(EditorPackageMountTable::HashString(RootName)); It; ++It)
+    {
+        const FEditorPackageMountRoot& Root = Roots[It.Value()];
+        if (RootName.Equals(Root.RootName, ESearchCase::IgnoreCase))
+        {
+            return &Root;
+        }
+    }
+    return nullptr;
+}
+
+bool FEditorPackageMountSnapshot::ContentDirEquals(FStringView Path, const FString& ContentDir)
+{
+    if (Path.Len() != ContentDir.Len())
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < Path.Len(); ++Index)
+    {
+        if (EditorPackageMountTable::NormalizeChar(Path[Index]) != EditorPackageMountTable::NormalizeChar(ContentDir[Index]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FEditorPackageMountTable& FEditorPackageMountTable::Get()
+{
+    static FEditorPackageMountTable Instance;
+    return Instance;
+}
+
+void FEditorPackageMountTable::Initialize()
+{
+    check(IsInGameThread());
+
+    // -- 플러그인도 FPackageName에 마운트 포인트를 등록하므로 콘텐츠 경로 이벤트만으로 갱신
+    ContentPathMountedHandle = FPackageName::OnContentPathMounted().AddRaw(this, &FEditorPackageMountTable::OnContentPathMounted);
+    ContentPathDismountedHandle = FPackageName::OnContentPathDismounted().AddRaw(this, &FEditorPackageMountTable::OnContentPathDismounted);
+
+    EnsureBuilt();
+}
+
+void FEditorPackageMountTable::Shutdown()
+{
+    check(IsInGameThread());
+
+    FPackageName::OnContentPathMounted().Remove(ContentPathMountedHandle);
+    FPackageName::OnContentPathDismounted().Remove(ContentPathDismountedHandle);
+    ContentPathMountedHandle.Reset();
+    ContentPathDismountedHandle.Reset();
+
+    Roots.Empty();
+
+    FWriteScopeLock WriteLock(SnapshotLock);
+    Snapshot.Reset();
+}
+
+FEditorPackageMountSnapshotRef FEditorPackageMountTable::GetSnapshot()
+{
+    {
+        FReadScopeLock ReadLock(SnapshotLock);
+        if (Snapshot.IsValid())
+        {
+            return Snapshot.ToSharedRef();
+        }
+    }
+
+    // -- 빌드는 IPluginManager와 FPackageName을 조회하므로 게임 스레드에서만
+    checkf(IsInGameThread(), TEXT("Mount table must be built on the game thread before it is queried from other threads"));
+    Rebuild();
+
+    FReadScopeLock ReadLock(SnapshotLock);
+    return Snapshot.ToSharedRef();
+}
+
+bool FEditorPackageMountTable::FindPackageRoot(FStringView FilePath, FStringView& OutRootName, FStringView& OutRelativePath)
+{
+    check(IsInGameThread());
+    return GetSnapshot()->FindPackageRoot(FilePath, OutRootName, OutRelativePath);
+}
+
+bool FEditorPackageMountTable::FindContentDir(FStringView PackageName, FStringView& OutContentDir, FStringView& OutRelativePath)
+{
+    check(IsInGameThread());
+    return GetSnapshot()->FindContentDir(PackageName, OutContentDir, OutRelativePath);
+}
+
+bool FEditorPackageMountTable::TryConvertFilenameToPackageName(FStringView Filename, FStringBuilderBase& OutPackageName)
+{
+    return GetSnapshot()->TryConvertFilenameToPackageName(Filename, OutPackageName);
+}
+
+bool FEditorPackageMountTable::TryConvertPackageNameToFilename(FStringView PackageName, FStringBuilderBase& OutFilename, FStringView Extension)
+{
+    return GetSnapshot()->TryConvertPackageNameToFilename(PackageName, OutFilename, Extension);
+}
+
+/**
+ * 파일 경로 목록을 패키지 이름으로 변환하는 함수.
+ * 호출 시점의 스냅샷 하나를 모든 작업이 공유하므로, 변환 도중 테이블이 바뀌어도 결과는 한 시점의 테이블 기준입니다.
+ */
+int32 FEditorPackageMountTable::ConvertFilenamesToPackageNames(TArrayView<const FString> Filenames, TArray<FString>& OutPackageNames)
+{
+    using namespace EditorPackageMountTable;
+
+    const FEditorPackageMountSnapshotRef CurrentSnapshot = GetSnapshot();
+
+    OutPackageNames.Reset();
+    OutPackageNames.SetNum(Filenames.Num());
+
+    const int32 NumBatches = FMath::DivideAndRoundUp(Filenames.Num(), BulkBatchSize);
+    std::atomic<int32> NumConverted{ 0 };
+    ParallelFor(NumBatches, [&CurrentSnapshot, Filenames, &OutPackageNames, &NumConverted](int32 BatchIndex)
+        {
+            const int32 Start = BatchIndex * BulkBatchSize;
+            const int32 End = FMath::Min(Start + BulkBatchSize, Filenames.Num());
+
+            int32 BatchConverted = 0;
+            TStringBuilder<512> PackageName;
+            for (int32 Index = Start; Index < End; ++Index)
+            {
+                PackageName.Reset();
+                if (CurrentSnapshot->TryConvertFilenameToPackageName(Filenames[Index], PackageName))
+                {
+                    OutPackageNames[Index] = PackageName.ToView();
+                    ++BatchConverted;
+                }
+            }
+            NumConverted.fetch_add(BatchConverted, std::memory_order_relaxed);
+        }, NumBatches <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    return NumConverted.load(std::memory_order_relaxed);
+}
+
+int32 FEditorPackageMountTable::ConvertPackageNamesToFilenames(TArrayView<const FString> PackageNames, TArray<FString>& OutFilenames, FStringView Extension)
+{
+    using namespace EditorPackageMountTable;
+
+    const FEditorPackageMountSnapshotRef CurrentSnapshot = GetSnapshot();
+
+    OutFilenames.Reset();
+    OutFilenames.SetNum(PackageNames.Num());
+
+    const int32 NumBatches = FMath::DivideAndRoundUp(PackageNames.Num(), BulkBatchSize);
+    std::atomic<int32> NumConverted{ 0 };
+    ParallelFor(NumBatches, [&CurrentSnapshot, PackageNames, Extension, &OutFilenames, &NumConverted](int32 BatchIndex)
+        {
+            const int32 Start = BatchIndex * BulkBatchSize;
+            const int32 End = FMath::Min(Start + BulkBatchSize, PackageNames.Num());
+
+            int32 BatchConverted = 0;
+            TStringBuilder<512> Filename;
+            for (int32 Index = Start; Index < End; ++Index)
+            {
+                Filename.Reset();
+                if (CurrentSnapshot->TryConvertPackageNameToFilename(PackageNames[Index], Filename, Extension))
+                {
+                    OutFilenames[Index] = Filename.ToView();
+                    ++BatchConverted;
+                }
+            }
+            NumConverted.fetch_add(BatchConverted, std::memory_order_relaxed);
+        }, NumBatches <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    return NumConverted.load(std::memory_order_relaxed);
+}
+
+void FEditorPackageMountTable::AddMountRoot(const FString& RootName, const FString& ContentDir)
+{
+    check(IsInGameThread());
+
+    AddRootNoIndex(RootName, ContentDir);
+    PublishSnapshot();
+}
+
+void FEditorPackageMountTable::AddRootNoIndex(const FString& RootName, const FString& ContentDir)
+{
+    const FString NormalizedDir = EditorPackageMountTable::NormalizeContentDir(ContentDir);
+
+    FMountRoot* Existing = Roots.FindByPredicate([&RootName](const FMountRoot& Root) { return Root.RootName.Equals(RootName, ESearchCase::IgnoreCase); });
+    if (Existing)
+    {
+        Existing->ContentDir = NormalizedDir;
+    }
+    else
+    {
+        Roots.Add({ RootName, NormalizedDir });
+    }
+}
+
+void FEditorPackageMountTable::RemoveMountRoot(const FString& RootName)
+{
+    check(IsInGameThread());
+
+    const int32 NumRemoved = Roots.RemoveAll([&RootName](const FMountRoot& Root) { return Root.RootName.Equals(RootName, ESearchCase::IgnoreCase); });
+    if (NumRemoved > 0)
+    {
+        PublishSnapshot();
+    }
+}
+
+void FEditorPackageMountTable::Rebuild()
+{
+    check(IsInGameThread());
+
+    Roots.Reset();
+
+    // -- 프로젝트 콘텐츠 디렉터리
+    AddRootNoIndex(TEXT("Game"), FPaths::ProjectContentDir());
+
+    // -- FPackageName에 등록된 마운트 포인트 (/Engine, 엔진/프로젝트 플러그인 등)
+    TArray<FString> RootPaths;
+    FPackageName::QueryRootContentPaths(RootPaths);
+    for (const FString& RootPath : RootPaths)
+    {
+        FString ContentDir;
+        if (FPackageName::TryConvertLongPackageNameToFilename(RootPath, ContentDir))
+        {
+            AddRootNoIndex(EditorPackageMountTable::TrimRootPath(RootPath), ContentDir);
+        }
+    }
+
+    // -- 아직 마운트 포인트가 등록되지 않은 활성화된 플러그인 (중첩 폴더 포함, 플러그인 설명자 경로 기준)
+    for (const TSharedRef<IPlugin>& Plugin : IPluginManager::Get().GetEnabledPluginsWithContent())
+    {
+        AddRootNoIndex(Plugin->GetName(), Plugin->GetContentDir());
+    }
+
+    PublishSnapshot();
+    UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Mount table built with %d content roots"), Roots.Num());
+}
+
+void FEditorPackageMountTable::OnContentPathMounted(const FString& AssetPath, const FString& ContentPath)
+{
+    RunOnGameThread([this, RootName = EditorPackageMountTable::TrimRootPath(AssetPath), ContentPath]()
+        {
+            AddMountRoot(RootName, ContentPath);
+        });
+}
+
+void FEditorPackageMountTable::OnContentPathDismounted(const FString& AssetPath, const FString& ContentPath)
+{
+    RunOnGameThread([this, RootName = EditorPackageMountTable::TrimRootPath(AssetPath)]()
+        {
+            RemoveMountRoot(RootName);
+        });
+}
+
+/**
+ * 마운트 이벤트에 따른 테이블 변경을 게임 스레드에서 실행하는 함수.
+ * FPackageName의 마운트 이벤트는 워커 스레드에서도 발생하므로 그때는 게임 스레드로 넘깁니다.
+ * 앞서 넘긴 변경이 아직 남아 있으면 게임 스레드에서 발생한 이벤트도 뒤에 줄 세워 마운트/언마운트 순서를 지킵니다.
+ */
+void FEditorPackageMountTable::RunOnGameThread(TUniqueFunction<void()>&& Update)
+{
+    if (IsInGameThread() && NumPendingUpdates.load(std::memory_order_acquire) == 0)
+    {
+        Update();
+        return;
+    }
+
+    NumPendingUpdates.fetch_add(1, std::memory_order_acq_rel);
+    AsyncTask(ENamedThreads::GameThread, [this, Update = MoveTemp(Update)]()
+        {
+            NumPendingUpdates.fetch_sub(1, std::memory_order_acq_rel);
+
+            // -- Shutdown 이후에 도착한 변경은 버림
+            if (ContentPathMountedHandle.IsValid())
+            {
+                Update();
+            }
+        });
+}
+
+void FEditorPackageMountTable::EnsureBuilt()
+{
+    check(IsInGameThread());
+
+    bool bBuilt;
+    {
+        FReadScopeLock ReadLock(SnapshotLock);
+        bBuilt = Snapshot.IsValid();
+    }
+
+    if (!bBuilt)
+    {
+        Rebuild();
+    }
+}
+
+void FEditorPackageMountTable::SetRoots(TArray<FMountRoot>&& InRoots)
+{
+    check(IsInGameThread());
+
+    Roots = MoveTemp(InRoots);
+    PublishSnapshot();
+}
+
+void FEditorPackageMountTable::PublishSnapshot()
+{
+    // -- 이전 스냅샷을 쓰는 스레드는 그대로 두고 새 스냅샷으로 교체
+    TSharedPtr<const FEditorPackageMountSnapshot, ESPMode::ThreadSafe> NewSnapshot = MakeShared<const FEditorPackageMountSnapshot, ESPMode::ThreadSafe>(Roots);
+
+    FWriteScopeLock WriteLock(SnapshotLock);
+    Snapshot = MoveTemp(NewSnapshot);
+}
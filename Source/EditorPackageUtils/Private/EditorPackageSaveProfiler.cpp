@@ -0,0 +1,355 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageSaveProfiler.h"
+#include "EditorPackageUtilsLog.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/ArchiveUObject.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+namespace EditorPackageSaveProfiler
+{
+    static constexpr int32 DefaultTopN = 10;
+
+    static TAutoConsoleVariable<bool> CVarSaveProfiler(
+        TEXT("EditorPackageUtils.SaveProfiler"),
+        false,
+        TEXT("1이면 패키지 저장 비용을 단계별, 에셋 클래스별, 패키지별로 기록합니다. EditorPackageUtils.SaveReport로 확인합니다."));
+
+    /** 직렬화한 바이트 수만 세는 아카이브. 오브젝트 참조와 이름은 패키지에 기록되는 인덱스 크기로 셉니다. */
+    class FSizeCountingArchive : public FArchiveUObject
+    {
+    public:
+        FSizeCountingArchive()
+        {
+            SetIsSaving(true);
+            SetIsPersistent(true);
+        }
+
+        virtual FString GetArchiveName() const override { return TEXT("FSizeCountingArchive"); }
+
+        virtual void Serialize(void* Data, int64 Num) override
+        {
+            Size += Num;
+        }
+
+        virtual FArchive& operator<<(FName& Value) override
+        {
+            // -- 이름 테이블 인덱스 + Number
+            Size += sizeof(int32) * 2;
+            return *this;
+        }
+
+        virtual FArchive& operator<<(UObject*& Value) override
+        {
+            // -- FPackageIndex
+            Size += sizeof(int32);
+            return *this;
+        }
+
+        using FArchiveUObject::operator<<;
+
+        int64 Size = 0;
+    };
+
+    static void AppendTotals(FStringBuilderBase& Csv, const TCHAR* Section, FStringView Name, const FEditorPackageSaveProfiler::FTotals& Totals)
+    {
+        Csv.Appendf(TEXT("%s,%.*s,%lld,%.4f"), Section, Name.Len(), Name.GetData(), Totals.Count, FPlatformTime::ToMilliseconds64(Totals.GetTotalCycles()));
+        for (uint64 Cycles : Totals.PhaseCycles)
+        {
+            Csv.Appendf(TEXT(",%.4f"), FPlatformTime::ToMilliseconds64(Cycles));
+        }
+        Csv.Appendf(TEXT(",%lld,%lld\n"), Totals.BytesWritten, Totals.SerializedSize);
+    }
+
+    static void LogTotals(const TCHAR* Name, const FEditorPackageSaveProfiler::FTotals& Totals)
+    {
+        const double TotalMs = FPlatformTime::ToMilliseconds64(Totals.GetTotalCycles());
+
+        TStringBuilder<256> Phases;
+        for (int32 PhaseIndex = 0; PhaseIndex < (int32)EEditorPackageSavePhase::Num; ++PhaseIndex)
+        {
+            Phases.Appendf(TEXT(" %10.2f"), FPlatformTime::ToMilliseconds64(Totals.PhaseCycles[PhaseIndex]));
+        }
+
+        UE_LOG(LogEditorPackageUtils, Display, TEXT("%-48s %8lld %12.2f%s %12lld %12lld"),
+            Name, Totals.Count, TotalMs, Phases.ToString(), Totals.BytesWritten, Totals.SerializedSize);
+    }
+
+    static FAutoConsoleCommand SaveReportCommand(
+        TEXT("EditorPackageUtils.SaveReport"),
+        TEXT("패키지 저장 비용 보고서를 로그에 출력하고 CSV로 저장합니다. 인자: [TopN] [Filename]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+            {
+                const FEditorPackageSaveProfiler& Profiler = FEditorPackageSaveProfiler::Get();
+                const int32 TopN = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 0, FEditorPackageSaveProfiler::MaxSlowestPackages) : DefaultTopN;
+                const FString Filename = Args.Num() > 1 ? Args[1] : FEditorPackageSaveProfiler::GetDefaultCsvFilename();
+
+                if (!FEditorPackageSaveProfiler::IsEnabled())
+                {
+                    UE_LOG(LogEditorPackageUtils, Display, TEXT("Save profiler is off; set EditorPackageUtils.SaveProfiler 1 to record saves"));
+                }
+
+                Profiler.LogReport(TopN);
+                if (Profiler.WriteCsv(Filename, TopN))
+                {
+                    UE_LOG(LogEditorPackageUtils, Display, TEXT("Wrote save report to %s"), *Filename);
+                }
+            }));
+
+    static FAutoConsoleCommand ResetSaveReportCommand(
+        TEXT("EditorPackageUtils.ResetSaveReport"),
+        TEXT("패키지 저장 비용 집계를 초기화합니다."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FEditorPackageSaveProfiler::Get().Reset();
+            }));
+}
+
+uint64 FEditorPackageSaveProfiler::FTotals::GetTotalCycles() const
+{
+    uint64 Total = 0;
+    for (uint64 Cycles : PhaseCycles)
+    {
+        Total += Cycles;
+    }
+    return Total - PhaseCycles[(int32)EEditorPackageSavePhase::WriteDrain];
+}
+
+FEditorPackageSaveProfiler& FEditorPackageSaveProfiler::Get()
+{
+    static FEditorPackageSaveProfiler Instance;
+    return Instance;
+}
+
+bool FEditorPackageSaveProfiler::IsEnabled()
+{
+    return EditorPackageSaveProfiler::CVarSaveProfiler.GetValueOnAnyThread();
+}
+
+const TCHAR* FEditorPackageSaveProfiler::GetPhaseName(EEditorPackageSavePhase Phase)
+{
+    static const TCHAR* const Names[] =
+    {
+        TEXT("PathConversion"),
+        TEXT("Registry"),
+        TEXT("Rename"),
+        TEXT("Serialization"),
+        TEXT("FileIO"),
+        TEXT("WriteDrain"),
+    };
+    static_assert(UE_ARRAY_COUNT(Names) == (int32)EEditorPackageSavePhase::Num, "Phase name table is out of sync");
+
+    return Names[(int32)Phase];
+}
+
+FString FEditorPackageSaveProfiler::GetDefaultCsvFilename()
+{
+    return FPaths::Combine(FPaths::ProfilingDir(), TEXT("EditorPackageSaveReport.csv"));
+}
+
+/**
+ * 에셋과 하위 오브젝트의 스크립트 프로퍼티를 크기만 세는 아카이브로 직렬화하는 함수.
+ * 패키지 요약, 이름/임포트/익스포트 테이블과 커스텀 Serialize의 벌크 데이터는 포함하지 않으므로,
+ * 기록된 파일 크기와의 차이로 그런 부가 데이터의 비중을 가늠할 수 있습니다.
+ */
+int64 FEditorPackageSaveProfiler::ComputeSerializedSize(UObject* Asset)
+{
+    check(IsInGameThread());
+
+    if (!Asset)
+    {
+        return 0;
+    }
+
+    EditorPackageSaveProfiler::FSizeCountingArchive Archive;
+
+    TArray<UObject*> Objects;
+    Objects.Add(Asset);
+    GetObjectsWithOuter(Asset, Objects, true);
+
+    for (UObject* Object : Objects)
+    {
+        Object->SerializeScriptProperties(Archive);
+    }
+
+    return Archive.Size;
+}
+
+/**
+ * 저장한 패키지 하나를 집계에 더하는 함수.
+ * 가장 느린 패키지는 크기가 MaxSlowestPackages인 최소 힙으로 관리하므로, 기록 수와 무관하게 메모리와 비용이 일정합니다.
+ */
+void FEditorPackageSaveProfiler::RecordPackage(const UPackage* Package, UObject* Asset, const FEditorPackageSaveTiming& Timing, int64 BytesWritten)
+{
+    if (!Package)
+    {
+        return;
+    }
+
+    FPackageRecord Record;
+    Record.PackageName = Package->GetFName();
+    Record.ClassName = Asset ? Asset->GetClass()->GetFName() : NAME_None;
+    Record.Totals.Count = 1;
+    Record.Totals.BytesWritten = BytesWritten;
+    Record.Totals.SerializedSize = IsInGameThread() ? ComputeSerializedSize(Asset) : 0;
+    FMemory::Memcpy(Record.Totals.PhaseCycles, Timing.PhaseCycles, sizeof(Timing.PhaseCycles));
+
+    auto Accumulate = [&Record](FTotals& Totals)
+    {
+        Totals.Count += Record.Totals.Count;
+        Totals.BytesWritten += Record.Totals.BytesWritten;
+        Totals.SerializedSize += Record.Totals.SerializedSize;
+        for (int32 PhaseIndex = 0; PhaseIndex < (int32)EEditorPackageSavePhase::Num; ++PhaseIndex)
+        {
+            Totals.PhaseCycles[PhaseIndex] += Record.Totals.PhaseCycles[PhaseIndex];
+        }
+    };
+
+    auto IsFaster = [](const FPackageRecord& A, const FPackageRecord& B)
+    {
+        return A.Totals.GetTotalCycles() < B.Totals.GetTotalCycles();
+    };
+
+    FScopeLock ScopeLock(&Lock);
+
+    Accumulate(SessionTotals);
+    Accumulate(ClassTotals.FindOrAdd(Record.ClassName));
+
+    if (Slowest.Num() < MaxSlowestPackages)
+    {
+        Slowest.HeapPush(MoveTemp(Record), IsFaster);
+    }
+    else if (IsFaster(Slowest.HeapTop(), Record))
+    {
+        Slowest.HeapPopDiscard(IsFaster);
+        Slowest.HeapPush(MoveTemp(Record), IsFaster);
+    }
+}
+
+void FEditorPackageSaveProfiler::Reset()
+{
+    FScopeLock ScopeLock(&Lock);
+
+    SessionTotals = FTotals();
+    ClassTotals.Empty();
+    Slowest.Empty();
+}
+
+TArray<FEditorPackageSaveProfiler::FPackageRecord> FEditorPackageSaveProfiler::GetSlowest(int32 TopN) const
+{
+    TArray<FPackageRecord> Sorted;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Sorted = Slowest;
+    }
+
+    Sorted.Sort([](const FPackageRecord& A, const FPackageRecord& B)
+        {
+            return A.Totals.GetTotalCycles() > B.Totals.GetTotalCycles();
+        });
+    Sorted.SetNum(FMath::Min(Sorted.Num(), FMath::Max(TopN, 0)));
+    return Sorted;
+}
+
+void FEditorPackageSaveProfiler::LogReport(int32 TopN) const
+{
+    using namespace EditorPackageSaveProfiler;
+
+    FTotals Session;
+    TMap<FName, FTotals> Classes;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Session = SessionTotals;
+        Classes = ClassTotals;
+    }
+    Classes.ValueSort([](const FTotals& A, const FTotals& B) { return A.GetTotalCycles() > B.GetTotalCycles(); });
+
+    TStringBuilder<256> Header;
+    Header.Appendf(TEXT("%-48s %8s %12s"), TEXT("Name"), TEXT("Count"), TEXT("TotalMs"));
+    for (int32 PhaseIndex = 0; PhaseIndex < (int32)EEditorPackageSavePhase::Num; ++PhaseIndex)
+    {
+        Header.Appendf(TEXT(" %10.10s"), GetPhaseName((EEditorPackageSavePhase)PhaseIndex));
+    }
+    Header.Appendf(TEXT(" %12s %12s"), TEXT("BytesWritten"), TEXT("Serialized"));
+
+    UE_LOG(LogEditorPackageUtils, Display, TEXT("%s"), Header.ToString());
+    LogTotals(TEXT("[Total]"), Session);
+
+    UE_LOG(LogEditorPackageUtils, Display, TEXT("-- By asset class"));
+    for (const TPair<FName, FTotals>& Pair : Classes)
+    {
+        LogTotals(*Pair.Key.ToString(), Pair.Value);
+    }
+
+    const TArray<FPackageRecord> SlowestPackages = GetSlowest(TopN);
+    UE_LOG(LogEditorPackageUtils, Display, TEXT("-- Slowest %d packages"), SlowestPackages.Num());
+    for (const FPackageRecord& Record : SlowestPackages)
+    {
+        LogTotals(*Record.PackageName.ToString(), Record.Totals);
+    }
+
+    if (Session.Count > 0)
+    {
+        const double TotalSeconds = FPlatformTime::ToSeconds64(Session.GetTotalCycles());
+        UE_LOG(LogEditorPackageUtils, Display, TEXT("Saved %lld packages in %.2f s (%.1f packages/s, %.2f MB/s)"),
+            Session.Count, TotalSeconds,
+            TotalSeconds > 0.0 ? Session.Count / TotalSeconds : 0.0,
+            TotalSeconds > 0.0 ? Session.BytesWritten / (1024.0 * 1024.0) / TotalSeconds : 0.0);
+    }
+}
+
+FString FEditorPackageSaveProfiler::ToCsv(int32 TopN) const
+{
+    using namespace EditorPackageSaveProfiler;
+
+    FTotals Session;
+    TMap<FName, FTotals> Classes;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Session = SessionTotals;
+        Classes = ClassTotals;
+    }
+    Classes.ValueSort([](const FTotals& A, const FTotals& B) { return A.GetTotalCycles() > B.GetTotalCycles(); });
+
+    TStringBuilder<4096> Csv;
+    Csv << TEXT("Section,Name,Count,TotalMs");
+    for (int32 PhaseIndex = 0; PhaseIndex < (int32)EEditorPackageSavePhase::Num; ++PhaseIndex)
+    {
+        Csv.Appendf(TEXT(",%sMs"), GetPhaseName((EEditorPackageSavePhase)PhaseIndex));
+    }
+    Csv << TEXT(",BytesWritten,SerializedSize\n");
+
+    AppendTotals(Csv, TEXT("Total"), TEXTVIEW(""), Session);
+
+    TStringBuilder<FName::StringBufferSize> Name;
+    for (const TPair<FName, FTotals>& Pair : Classes)
+    {
+        Name.Reset();
+        Pair.Key.AppendString(Name);
+        AppendTotals(Csv, TEXT("Class"), Name.ToView(), Pair.Value);
+    }
+
+    for (const FPackageRecord& Record : GetSlowest(TopN))
+    {
+        Name.Reset();
+        Record.PackageName.AppendString(Name);
+        AppendTotals(Csv, TEXT("Package"), Name.ToView(), Record.Totals);
+    }
+
+    return FString(Csv.ToView());
+}
+
+bool FEditorPackageSaveProfiler::WriteCsv(const FString& Filename, int32 TopN) const
+{
+    if (!FFileHelper::SaveStringToFile(ToCsv(TopN), *Filename))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to write save report: %s"), *Filename);
+        return false;
+    }
+    return true;
+}
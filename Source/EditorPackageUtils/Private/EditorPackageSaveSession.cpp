@@ -0,0 +1,293 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageSaveSession.h"
+#include "EditorPackageUtilsLog.h"
+#include "EditorPackageUtilsPrivate.h"
+#include "EditorPackageUtilsStats.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/PackagePath.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+namespace EditorPackageSaveSession
+{
+    /** 게임 스레드의 현재 세션. */
+    static FEditorPackageSaveSession* CurrentSession = nullptr;
+}
+
+FEditorPackageSaveSession::FEditorPackageSaveSession()
+    : FEditorPackageSaveSession(FOptions())
+{
+}
+
+FEditorPackageSaveSession::FEditorPackageSaveSession(const FOptions& InOptions)
+    : Options(InOptions)
+{
+    check(IsInGameThread());
+
+    PreviousSession = EditorPackageSaveSession::CurrentSession;
+    EditorPackageSaveSession::CurrentSession = this;
+}
+
+FEditorPackageSaveSession::~FEditorPackageSaveSession()
+{
+    Flush();
+
+    if (!StagingDirectory.IsEmpty())
+    {
+        IFileManager::Get().DeleteDirectory(*StagingDirectory, false, true);
+    }
+
+    if (EditorPackageSaveSession::CurrentSession == this)
+    {
+        EditorPackageSaveSession::CurrentSession = PreviousSession;
+    }
+}
+
+FEditorPackageSaveSession* FEditorPackageSaveSession::GetCurrent()
+{
+    return IsInGameThread() ? EditorPackageSaveSession::CurrentSession : nullptr;
+}
+
+/**
+ * 디렉터리 존재를 확인하는 함수.
+ * 확인한 디렉터리와 그 상위 디렉터리를 모두 기억하므로 같은 트리 아래의 저장은 파일 시스템을 다시 조회하지 않습니다.
+ * 세션 도중 외부에서 디렉터리를 지우는 경우는 고려하지 않습니다.
+ */
+bool FEditorPackageSaveSession::EnsureDirectoryExists(const FString& Directory)
+{
+    FString NormalizedDirectory = FPaths::ConvertRelativePathToFull(Directory);
+    FPaths::NormalizeDirectoryName(NormalizedDirectory);
+
+    if (KnownDirectories.Contains(NormalizedDirectory))
+    {
+        ++Stats.DirectoryCacheHits;
+        return true;
+    }
+
+    IFileManager& FileManager = IFileManager::Get();
+
+    ++Stats.DirectoryChecks;
+    if (!FileManager.DirectoryExists(*NormalizedDirectory))
+    {
+        if (!FileManager.MakeDirectory(*NormalizedDirectory, true))
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to create directory: %s"), *NormalizedDirectory);
+            return false;
+        }
+        ++Stats.DirectoriesCreated;
+        UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Created directory: %s"), *NormalizedDirectory);
+    }
+
+    // -- 하위 디렉터리가 있으면 상위 디렉터리도 있음
+    FString KnownDirectory = MoveTemp(NormalizedDirectory);
+    while (!KnownDirectory.IsEmpty() && !KnownDirectories.Contains(KnownDirectory))
+    {
+        FString ParentDirectory = FPaths::GetPath(KnownDirectory);
+        KnownDirectories.Add(MoveTemp(KnownDirectory));
+        KnownDirectory = MoveTemp(ParentDirectory);
+    }
+
+    return true;
+}
+
+FString FEditorPackageSaveSession::MakeStagingFilename(const FString& Filename)
+{
+    if (StagingDirectory.IsEmpty())
+    {
+        StagingDirectory = FPaths::Combine(FPlatformProcess::UserTempDir(), TEXT("EditorPackageUtils"), FGuid::NewGuid().ToString());
+        IFileManager::Get().MakeDirectory(*StagingDirectory, true);
+    }
+
+    // -- 맵 여부를 확장자로 판단하는 코드가 있으므로 대상과 같은 확장자 사용
+    return FPaths::Combine(StagingDirectory, FString::Printf(TEXT("%d%s"), NumStagingFiles++, *FPaths::GetExtension(Filename, true)));
+}
+
+/**
+ * SaveObject를 저장하는 함수.
+ * 메모리 스테이징을 사용하면 로컬 임시 파일에 직렬화한 뒤 바이트를 메모리로 옮기고 임시 파일은 바로 지웁니다.
+ * UPackage::Save가 로드 경로를 임시 파일로 바꾸므로, 임시 파일을 지우기 전에 원래 로드 경로로 되돌립니다.
+ * 로드 경로는 Flush에서 기록에 성공한 패키지만 대상 파일로 바꿉니다.
+ * 모은 바이트가 MaxStagedBytes를 넘으면 그 자리에서 Flush합니다.
+ */
+FEditorPackageSaveResult FEditorPackageSaveSession::SaveAsset(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(SaveSessionSaveAsset);
+    check(IsInGameThread());
+
+    FEditorPackageSaveResult Result;
+    Result.Package = EditorPackageUtilsPrivate::PrepareAssetForSave(SaveObject, SaveDirectory, FileName, Result.Filename);
+    if (!Result.Package)
+    {
+        ++Stats.PackagesFailed;
+        return Result;
+    }
+
+    const FString SaveFilename = Options.bStageInMemory ? MakeStagingFilename(Result.Filename) : Result.Filename;
+    const FPackagePath OriginalLoadedPath = Result.Package->GetLoadedPath();
+
+    const double SerializeStartTime = FPlatformTime::Seconds();
+    const FSavePackageResultStruct SaveResult = UPackage::Save(Result.Package, SaveObject, *SaveFilename, EditorPackageUtilsPrivate::MakeSaveArgs());
+    Stats.SerializeSeconds += FPlatformTime::Seconds() - SerializeStartTime;
+
+    // -- 임시 파일은 곧 지워지므로 성공 여부와 관계없이 원래 로드 경로를 유지
+    if (Options.bStageInMemory)
+    {
+        Result.Package->SetLoadedPath(OriginalLoadedPath);
+    }
+
+    if (!SaveResult.IsSuccessful())
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to save package: %s"), *Result.Filename);
+        ++Stats.PackagesFailed;
+        return Result;
+    }
+
+    Result.bSuccess = true;
+    Result.FileSize = SaveResult.TotalFileSize;
+
+    if (!Options.bStageInMemory)
+    {
+        ++Stats.PackagesSaved;
+        ++Stats.FileWrites;
+        Stats.BytesWritten += Result.FileSize;
+        FEditorPackageUtilsStats::Get().RecordBytesSaved(Result.FileSize);
+        return Result;
+    }
+
+    // -- 로컬 임시 파일의 바이트를 메모리로 옮김
+    FStagedPackage& Staged = StagedPackages.AddDefaulted_GetRef();
+    Staged.Package = Result.Package;
+    Staged.Filename = Result.Filename;
+    const bool bLoaded = FFileHelper::LoadFileToArray(Staged.Bytes, *SaveFilename);
+    IFileManager::Get().Delete(*SaveFilename, false, true, true);
+
+    if (!bLoaded)
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to read staged package: %s"), *SaveFilename);
+        StagedPackages.Pop(false);
+
+        // -- 임시 파일 저장이 더티 표시를 지웠으므로 편집 내용이 남아 있음을 다시 표시
+        Result.Package->SetDirtyFlag(true);
+        ++Stats.PackagesFailed;
+        Result.bSuccess = false;
+        return Result;
+    }
+
+    Result.FileSize = Staged.Bytes.Num();
+    StagedBytes += Staged.Bytes.Num();
+    Stats.PeakStagedBytes = FMath::Max(Stats.PeakStagedBytes, StagedBytes);
+
+    if (StagedBytes >= Options.MaxStagedBytes)
+    {
+        Flush();
+    }
+
+    return Result;
+}
+
+/**
+ * 패키지 하나를 기록하는 함수.
+ * 대상과 같은 디렉터리의 임시 파일에 한 번의 쓰기로 기록한 뒤 이름을 바꾸므로 같은 볼륨 안의 교체로 처리됩니다.
+ */
+bool FEditorPackageSaveSession::WriteStagedPackage(const FStagedPackage& Staged)
+{
+    IFileManager& FileManager = IFileManager::Get();
+    const FString TempFilename = Staged.Filename + TEXT(".tmp");
+
+    ++Stats.FileWrites;
+    {
+        TUniquePtr<FArchive> Writer(FileManager.CreateFileWriter(*TempFilename, FILEWRITE_EvenIfReadOnly));
+        if (!Writer)
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to open package for writing: %s"), *TempFilename);
+            return false;
+        }
+
+        Writer->Serialize(const_cast<uint8*>(Staged.Bytes.GetData()), Staged.Bytes.Num());
+        if (!Writer->Close())
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to write package: %s"), *TempFilename);
+            FileManager.Delete(*TempFilename, false, true, true);
+            return false;
+        }
+    }
+
+    ++Stats.Renames;
+    if (!FileManager.Move(*Staged.Filename, *TempFilename, true, true))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to replace package: %s"), *Staged.Filename);
+        FileManager.Delete(*TempFilename, false, true, true);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * 모아 둔 패키지를 모두 기록하는 함수.
+ * 기록이 끝난 패키지만 로드 경로를 대상 파일로 바꿉니다. 기록에 실패한 패키지는 SaveAsset 이전의 로드 경로를 그대로 유지하고,
+ * 임시 파일로 저장할 때 지워진 더티 표시를 되돌려 편집 내용이 저장되지 않은 채 사라지지 않도록 합니다.
+ */
+bool FEditorPackageSaveSession::Flush()
+{
+    if (StagedPackages.Num() == 0)
+    {
+        return true;
+    }
+
+    EDITORPACKAGEUTILS_SCOPED_STAT(SaveSessionFlush);
+    check(IsInGameThread());
+
+    const double WriteStartTime = FPlatformTime::Seconds();
+
+    bool bAllWritten = true;
+    for (const FStagedPackage& Staged : StagedPackages)
+    {
+        if (!WriteStagedPackage(Staged))
+        {
+            ++Stats.PackagesFailed;
+            bAllWritten = false;
+
+            if (UPackage* Package = Staged.Package.Get())
+            {
+                Package->SetDirtyFlag(true);
+            }
+            continue;
+        }
+
+        ++Stats.PackagesSaved;
+        Stats.BytesWritten += Staged.Bytes.Num();
+        FEditorPackageUtilsStats::Get().RecordBytesSaved(Staged.Bytes.Num());
+
+        if (UPackage* Package = Staged.Package.Get())
+        {
+            Package->SetLoadedPath(FPackagePath::FromLocalPath(Staged.Filename));
+        }
+    }
+
+    Stats.WriteSeconds += FPlatformTime::Seconds() - WriteStartTime;
+
+    UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Flushed %d staged packages (%lld bytes)"), StagedPackages.Num(), StagedBytes);
+
+    StagedPackages.Reset();
+    StagedBytes = 0;
+    return bAllWritten;
+}
+
+void FEditorPackageSaveSession::LogStats() const
+{
+    const int32 DirectoryLookups = Stats.DirectoryCacheHits + Stats.DirectoryChecks;
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("Save session: %d packages saved, %d failed, %.2f MB written"),
+        Stats.PackagesSaved, Stats.PackagesFailed, Stats.BytesWritten / (1024.0 * 1024.0));
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("  Directories: %d lookups, %d cache hits (%.1f%%), %d created"),
+        DirectoryLookups, Stats.DirectoryCacheHits, DirectoryLookups > 0 ? 100.0 * Stats.DirectoryCacheHits / DirectoryLookups : 0.0, Stats.DirectoriesCreated);
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("  Files: %d writes, %d renames, peak staged %.2f MB"),
+        Stats.FileWrites, Stats.Renames, Stats.PeakStagedBytes / (1024.0 * 1024.0));
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("  Time: serialize %.1f ms, write %.1f ms"),
+        Stats.SerializeSeconds * 1000.0, Stats.WriteSeconds * 1000.0);
+}
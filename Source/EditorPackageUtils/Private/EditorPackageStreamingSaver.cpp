@@ -0,0 +1,196 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageStreamingSaver.h"
+#include "EditorPackageSaveProfiler.h"
+#include "EditorPackageUtilsLog.h"
+#include "EditorPackageUtilsPrivate.h"
+#include "EditorPackageUtilsStats.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+FEditorPackageStreamingSaver::FEditorPackageStreamingSaver()
+    : FEditorPackageStreamingSaver(FOptions())
+{
+}
+
+FEditorPackageStreamingSaver::FEditorPackageStreamingSaver(const FOptions& InOptions)
+    : Options(InOptions)
+{
+    check(IsInGameThread());
+
+    Options.MinGCInterval = FMath::Max(Options.MinGCInterval, 1);
+    Options.MaxGCInterval = FMath::Max(Options.MaxGCInterval, Options.MinGCInterval);
+    Stats.CurrentGCInterval = Options.MinGCInterval;
+    Stats.UsedPhysicalAfterLastGC = FPlatformMemory::GetStats().UsedPhysical;
+}
+
+FEditorPackageStreamingSaver::~FEditorPackageStreamingSaver()
+{
+    Finish();
+}
+
+/**
+ * SaveObject를 저장하는 함수.
+ * 저장에 성공하면 오브젝트를 GC 대상으로 돌리고, 미뤄 둔 정리를 시간 제한 안에서 진행한 뒤 메모리 사용량에 따라 GC합니다.
+ * 저장에 실패한 오브젝트와 패키지는 작업을 잃지 않도록 플래그와 더티 상태를 그대로 둡니다.
+ */
+FEditorPackageSaveResult FEditorPackageStreamingSaver::Save(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(StreamingSave);
+    check(IsInGameThread());
+
+    FEditorPackageSaveTiming Timing;
+    FEditorPackageSaveTiming* const OutTiming = FEditorPackageSaveProfiler::IsEnabled() ? &Timing : nullptr;
+
+    FEditorPackageSaveResult Result;
+    Result.Package = EditorPackageUtilsPrivate::PrepareAssetForSave(SaveObject, SaveDirectory, FileName, Result.Filename, true, OutTiming);
+    if (Result.Package)
+    {
+        const FSavePackageResultStruct SaveResult = EditorPackageUtilsPrivate::SavePackage(Result.Package, SaveObject, Result.Filename, SAVE_None, OutTiming);
+        if (SaveResult.IsSuccessful())
+        {
+            Result.bSuccess = true;
+            Result.FileSize = SaveResult.TotalFileSize;
+            FEditorPackageUtilsStats::Get().RecordBytesSaved(Result.FileSize);
+
+            // -- 해제 전에 기록해야 직렬화 크기를 계산할 수 있음
+            if (OutTiming)
+            {
+                FEditorPackageSaveProfiler::Get().RecordPackage(Result.Package, SaveObject, Timing, Result.FileSize);
+            }
+        }
+        else
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to save package: %s (left in memory and dirty)"), *Result.Filename);
+        }
+    }
+
+    // -- 기록하지 못한 패키지를 해제하면 저장하지 않은 작업을 잃으므로 성공한 경우만 해제
+    if (Result.bSuccess)
+    {
+        ReleaseForGC(SaveObject, Result.Package);
+    }
+
+    if (Result.bSuccess)
+    {
+        ++Stats.PackagesSaved;
+        Stats.BytesSaved += Result.FileSize;
+    }
+    else
+    {
+        ++Stats.PackagesFailed;
+    }
+    ++PackagesSinceGC;
+
+    // -- 미뤄 둔 정리를 조금씩 진행
+    if (Options.IncrementalPurgeTimeLimit > 0.0 && IsIncrementalPurgePending())
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        IncrementalPurgeGarbage(true, Options.IncrementalPurgeTimeLimit);
+        Stats.GCSeconds += FPlatformTime::Seconds() - StartTime;
+    }
+
+    UpdateMemoryAndMaybeCollect();
+    return Result;
+}
+
+void FEditorPackageStreamingSaver::Finish()
+{
+    if (PackagesSinceGC > 0 || IsIncrementalPurgePending())
+    {
+        CollectGarbageNow(true);
+    }
+}
+
+void FEditorPackageStreamingSaver::ReleaseForGC(UObject* SaveObject, UPackage* Package)
+{
+    SaveObject->ClearFlags(RF_Standalone);
+    if (SaveObject->IsRooted())
+    {
+        SaveObject->RemoveFromRoot();
+    }
+
+    if (Package)
+    {
+        Package->ClearFlags(RF_Standalone);
+        if (Package->IsRooted())
+        {
+            Package->RemoveFromRoot();
+        }
+
+        // -- 저장 후에는 더티가 아니므로 에디터가 저장 확인을 위해 붙잡지 않음
+        Package->SetDirtyFlag(false);
+    }
+}
+
+void FEditorPackageStreamingSaver::UpdateMemoryAndMaybeCollect()
+{
+    const int64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+    Stats.PeakUsedPhysical = FMath::Max(Stats.PeakUsedPhysical, UsedPhysical);
+
+    // -- 예산 초과여도 MinGCInterval은 지켜야 GC 후에도 예산을 넘는 경우 저장마다 GC하지 않음
+    const bool bOverBudget = UsedPhysical >= Options.MemoryBudgetBytes && PackagesSinceGC >= Options.MinGCInterval;
+    if (bOverBudget || PackagesSinceGC >= Stats.CurrentGCInterval)
+    {
+        UpdateGCInterval(UsedPhysical);
+        CollectGarbageNow(Options.IncrementalPurgeTimeLimit <= 0.0);
+    }
+}
+
+/**
+ * 다음 GC 간격을 계산하는 함수.
+ * 마지막 GC 직후 사용량에서 예산의 목표 비율까지 남은 메모리를 패키지당 증가량으로 나눈 값을 사용합니다.
+ * 패키지당 증가량을 측정할 수 없으면 간격을 두 배로 늘립니다.
+ */
+void FEditorPackageStreamingSaver::UpdateGCInterval(int64 UsedPhysical)
+{
+    const int64 Growth = UsedPhysical - Stats.UsedPhysicalAfterLastGC;
+    const int64 TargetBytes = (int64)(Options.MemoryBudgetBytes * Options.TargetBudgetRatio);
+    const int64 Headroom = TargetBytes - Stats.UsedPhysicalAfterLastGC;
+
+    int64 Interval = (int64)Stats.CurrentGCInterval * 2;
+    if (Growth > 0 && PackagesSinceGC > 0)
+    {
+        const int64 BytesPerPackage = FMath::Max<int64>(Growth / PackagesSinceGC, 1);
+        Interval = Headroom > 0 ? Headroom / BytesPerPackage : 0;
+    }
+
+    Stats.CurrentGCInterval = (int32)FMath::Clamp<int64>(Interval, Options.MinGCInterval, Options.MaxGCInterval);
+}
+
+void FEditorPackageStreamingSaver::CollectGarbageNow(bool bFullPurge)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, bFullPurge);
+    const double GCSeconds = FPlatformTime::Seconds() - StartTime;
+
+    ++Stats.GCCount;
+    Stats.GCSeconds += GCSeconds;
+    Stats.MaxGCSeconds = FMath::Max(Stats.MaxGCSeconds, GCSeconds);
+    Stats.UsedPhysicalAfterLastGC = FPlatformMemory::GetStats().UsedPhysical;
+    PackagesSinceGC = 0;
+
+    UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Streaming save GC #%d: %.1f ms, %.1f MB used, next interval %d packages"),
+        Stats.GCCount, GCSeconds * 1000.0, Stats.UsedPhysicalAfterLastGC / (1024.0 * 1024.0), Stats.CurrentGCInterval);
+
+    // -- GC 직후에도 예산을 넘으면 저장 외의 원인이 메모리를 잡고 있음
+    if (!bWarnedBudgetTooSmall && Stats.UsedPhysicalAfterLastGC >= Options.MemoryBudgetBytes)
+    {
+        bWarnedBudgetTooSmall = true;
+        UE_LOG(LogEditorPackageUtils, Warning, TEXT("Memory use after GC (%.1f MB) exceeds the streaming save budget (%.1f MB); saved objects may still be referenced"),
+            Stats.UsedPhysicalAfterLastGC / (1024.0 * 1024.0), Options.MemoryBudgetBytes / (1024.0 * 1024.0));
+    }
+}
+
+void FEditorPackageStreamingSaver::LogStats() const
+{
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("Streaming save: %d packages saved, %d failed, %.2f MB written"),
+        Stats.PackagesSaved, Stats.PackagesFailed, Stats.BytesSaved / (1024.0 * 1024.0));
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("  GC: %d runs, %.1f ms total, %.1f ms max, interval %d packages"),
+        Stats.GCCount, Stats.GCSeconds * 1000.0, Stats.MaxGCSeconds * 1000.0, Stats.CurrentGCInterval);
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("  Memory: peak %.1f MB, %.1f MB after last GC, budget %.1f MB"),
+        Stats.PeakUsedPhysical / (1024.0 * 1024.0), Stats.UsedPhysicalAfterLastGC / (1024.0 * 1024.0), Options.MemoryBudgetBytes / (1024.0 * 1024.0));
+}
@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageTemporaryMount.h"
+#include "EditorPackageMountTable.h"
+#include "EditorPackageUtilsLog.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+FEditorPackageTemporaryMount::FEditorPackageTemporaryMount(const FString& InRootName, const FString& InContentDir)
+    : RootPath(FString::Printf(TEXT("/%s/"), *InRootName))
+    , ContentDir(FPaths::ConvertRelativePathToFull(InContentDir))
+{
+    check(IsInGameThread());
+
+    FPaths::NormalizeDirectoryName(ContentDir);
+
+    // -- 이전 실행이 비정상 종료되어 남은 파일은 지우고 시작
+    IFileManager::Get().DeleteDirectory(*ContentDir, false, true);
+    IFileManager::Get().MakeDirectory(*ContentDir, true);
+
+    FPackageName::RegisterMountPoint(RootPath, ContentDir / TEXT(""));
+
+    // -- 앞서 게임 스레드로 넘긴 마운트 이벤트가 남아 있으면 테이블 반영이 늦어지므로 바로 등록
+    FEditorPackageMountTable::Get().AddMountRoot(InRootName, ContentDir);
+    UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Mounted temporary content root %s -> %s"), *RootPath, *ContentDir);
+}
+
+FEditorPackageTemporaryMount::~FEditorPackageTemporaryMount()
+{
+    check(IsInGameThread());
+
+    PurgePackages();
+
+    // -- 언마운트 이벤트로 Asset Registry가 경로 아래의 캐시를, 마운트 테이블이 루트를 제거
+    FPackageName::UnRegisterMountPoint(RootPath, ContentDir / TEXT(""));
+    IFileManager::Get().DeleteDirectory(*ContentDir, false, true);
+    UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Unmounted temporary content root %s"), *RootPath);
+}
+
+void FEditorPackageTemporaryMount::PurgePackages() const
+{
+    TArray<UPackage*> Packages;
+    for (TObjectIterator<UPackage> It; It; ++It)
+    {
+        if (It->GetName().StartsWith(RootPath, ESearchCase::IgnoreCase))
+        {
+            Packages.Add(*It);
+        }
+    }
+    if (Packages.Num() == 0)
+    {
+        return;
+    }
+
+    for (UPackage* Package : Packages)
+    {
+        ForEachObjectWithPackage(Package, [](UObject* Object)
+            {
+                if (Object->IsAsset())
+                {
+                    FAssetRegistryModule::AssetDeleted(Object);
+                }
+                Object->ClearFlags(RF_Public | RF_Standalone);
+                Object->MarkAsGarbage();
+                return true;
+            });
+        Package->ClearFlags(RF_Standalone);
+        Package->MarkAsGarbage();
+    }
+
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
@@ -0,0 +1,40 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 벤치마크와 자동화 테스트가 에셋을 저장할 임시 콘텐츠 루트.
+ * 생성하면 디렉터리를 비운 뒤 FPackageName에 마운트 포인트로 등록하고(마운트 테이블도 이벤트로 함께 갱신됩니다),
+ * 소멸하면 루트 아래의 패키지를 Asset Registry에서 지우고 언로드한 뒤 마운트를 해제하고 디렉터리를 삭제합니다.
+ * 프로젝트 Content 폴더와 Asset Registry에 흔적이 남지 않도록 디렉터리는 Intermediate 아래를 사용합니다.
+ *
+ * @note 게임 스레드에서만 생성하고 소멸해야 합니다.
+ */
+class FEditorPackageTemporaryMount
+{
+public:
+    /**
+     * @param InRootName 패키지 루트 이름 (앞뒤 '/' 제외). 예: "EPUBenchmarkSave"
+     * @param InContentDir 콘텐츠 디렉터리. 이미 있으면 이전 실행이 남긴 파일로 보고 비웁니다.
+     */
+    FEditorPackageTemporaryMount(const FString& InRootName, const FString& InContentDir);
+    ~FEditorPackageTemporaryMount();
+
+    FEditorPackageTemporaryMount(const FEditorPackageTemporaryMount&) = delete;
+    FEditorPackageTemporaryMount& operator=(const FEditorPackageTemporaryMount&) = delete;
+
+    /** 마운트 포인트. 예: "/EPUBenchmarkSave/" */
+    const FString& GetRootPath() const { return RootPath; }
+
+    /** 콘텐츠 디렉터리의 절대 경로. '/' 구분자, 끝 '/' 없음. */
+    const FString& GetContentDir() const { return ContentDir; }
+
+private:
+    /** 루트 아래의 메모리 패키지를 Asset Registry에서 지우고 가비지 컬렉션으로 언로드합니다. */
+    void PurgePackages() const;
+
+    FString RootPath;
+    FString ContentDir;
+};
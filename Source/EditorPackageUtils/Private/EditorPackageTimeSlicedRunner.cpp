@@ -0,0 +1,352 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageTimeSlicedRunner.h"
+#include "EditorPackageUtilsLog.h"
+#include "EditorPackageUtilsStats.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "EditorPackageTimeSlicedRunner"
+
+namespace EditorPackageTimeSlicedRunner
+{
+    /** 항목당 처리 시간 이동 평균에서 새 측정값의 비중. 항목 비용이 바뀌어도 몇 슬라이스 안에 따라가도록 합니다. */
+    static constexpr double SmoothingFactor = 0.25;
+
+    static FAutoConsoleCommand ListBatchJobsCommand(
+        TEXT("EditorPackageUtils.ListBatchJobs"),
+        TEXT("시간 분할로 처리 중인 배치 작업 목록을 로그에 출력합니다."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                const TArray<TSharedRef<FEditorPackageBatchJob>>& Jobs = FEditorPackageTimeSlicedRunner::Get().GetJobs();
+                UE_LOG(LogEditorPackageUtils, Display, TEXT("%d batch jobs"), Jobs.Num());
+                for (const TSharedRef<FEditorPackageBatchJob>& Job : Jobs)
+                {
+                    UE_LOG(LogEditorPackageUtils, Display, TEXT("  %d/%d items, %.3f ms/item%s"),
+                        Job->GetNumProcessed(), Job->GetNumItems(), Job->GetAverageItemMs(), Job->IsPaused() ? TEXT(" (paused)") : TEXT(""));
+                }
+            }));
+
+    static FAutoConsoleCommand CancelBatchJobsCommand(
+        TEXT("EditorPackageUtils.CancelBatchJobs"),
+        TEXT("시간 분할로 처리 중인 배치 작업을 모두 취소합니다."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FEditorPackageTimeSlicedRunner::Get().CancelAll();
+            }));
+
+    static FText MakeProgressText(const FEditorPackageBatchJob& Job)
+    {
+        const int32 Percent = Job.GetNumItems() > 0 ? (int32)((int64)Job.GetNumProcessed() * 100 / Job.GetNumItems()) : 100;
+        return FText::Format(LOCTEXT("BatchJobProgress", "{0} / {1} ({2}%)"),
+            FText::AsNumber(Job.GetNumProcessed()), FText::AsNumber(Job.GetNumItems()), FText::AsNumber(Percent));
+    }
+}
+
+void FEditorPackageBatchJob::Pause()
+{
+    check(IsInGameThread());
+
+    if (!bPaused && !bFinished)
+    {
+        bPaused = true;
+        UpdateNotificationState();
+    }
+}
+
+void FEditorPackageBatchJob::Resume()
+{
+    check(IsInGameThread());
+
+    if (bPaused && !bFinished)
+    {
+        bPaused = false;
+        UpdateNotificationState();
+    }
+}
+
+void FEditorPackageBatchJob::Cancel()
+{
+    check(IsInGameThread());
+
+    bCanceled = true;
+}
+
+/**
+ * 노티피케이션의 완료 상태를 바꾸는 함수.
+ * 진행 중에는 CS_Pending(일시정지, 취소 버튼), 일시정지 중에는 CS_None(재개, 취소 버튼)을 사용합니다.
+ */
+void FEditorPackageBatchJob::UpdateNotificationState()
+{
+    if (NotificationItem.IsValid())
+    {
+        NotificationItem->SetCompletionState(bPaused ? SNotificationItem::CS_None : SNotificationItem::CS_Pending);
+        NotificationItem->SetText(bPaused ? FText::Format(LOCTEXT("BatchJobPaused", "{0} (paused)"), DisplayName) : DisplayName);
+    }
+}
+
+FEditorPackageTimeSlicedRunner& FEditorPackageTimeSlicedRunner::Get()
+{
+    static FEditorPackageTimeSlicedRunner Instance;
+    return Instance;
+}
+
+void FEditorPackageTimeSlicedRunner::Initialize()
+{
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEditorPackageTimeSlicedRunner::Tick));
+}
+
+void FEditorPackageTimeSlicedRunner::Shutdown()
+{
+    if (Jobs.Num() > 0)
+    {
+        UE_LOG(LogEditorPackageUtils, Warning, TEXT("Canceling %d unfinished batch jobs on shutdown"), Jobs.Num());
+        CancelAll();
+        FinishCompletedJobs();
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    TickHandle.Reset();
+}
+
+TSharedRef<FEditorPackageBatchJob> FEditorPackageTimeSlicedRunner::Submit(const FText& DisplayName, int32 NumItems, FOnEditorPackageBatchJobSlice ProcessSlice, FOnEditorPackageBatchJobFinished OnFinished)
+{
+    check(IsInGameThread());
+
+    TSharedRef<FEditorPackageBatchJob> Job = MakeShareable(new FEditorPackageBatchJob());
+    Job->DisplayName = DisplayName;
+    Job->NumItems = FMath::Max(NumItems, 0);
+    Job->ProcessSlice = MoveTemp(ProcessSlice);
+    Job->OnFinished = MoveTemp(OnFinished);
+    Job->SubmitTime = FPlatformTime::Seconds();
+
+    // -- 진행 노티피케이션 생성. 커맨드렛처럼 Slate가 없으면 생략
+    if (FSlateApplication::IsInitialized())
+    {
+        TWeakPtr<FEditorPackageBatchJob> WeakJob = Job;
+
+        FNotificationInfo Info(DisplayName);
+        Info.bFireAndForget = false;  // 자동으로 사라지지 않도록 설정
+        Info.FadeOutDuration = 0.5f;
+        Info.ExpireDuration = 0.0f;
+        Info.bUseThrobber = true;
+        Info.bUseSuccessFailIcons = true;
+        Info.SubText = EditorPackageTimeSlicedRunner::MakeProgressText(*Job);
+        Info.ButtonDetails.Add(FNotificationButtonInfo(
+            LOCTEXT("PauseBatchJob", "Pause"),
+            LOCTEXT("PauseBatchJobTooltip", "Pause this job. Items already processed are kept."),
+            FSimpleDelegate::CreateLambda([WeakJob]() { if (TSharedPtr<FEditorPackageBatchJob> Pinned = WeakJob.Pin()) { Pinned->Pause(); } }),
+            SNotificationItem::CS_Pending));
+        Info.ButtonDetails.Add(FNotificationButtonInfo(
+            LOCTEXT("ResumeBatchJob", "Resume"),
+            LOCTEXT("ResumeBatchJobTooltip", "Resume this job."),
+            FSimpleDelegate::CreateLambda([WeakJob]() { if (TSharedPtr<FEditorPackageBatchJob> Pinned = WeakJob.Pin()) { Pinned->Resume(); } }),
+            SNotificationItem::CS_None));
+
+        // -- 취소 버튼은 진행 중과 일시정지 중 모두 표시
+        FNotificationButtonInfo CancelButton(
+            LOCTEXT("CancelBatchJob", "Cancel"),
+            LOCTEXT("CancelBatchJobTooltip", "Cancel this job. Items already processed are kept."),
+            FSimpleDelegate::CreateLambda([WeakJob]() { if (TSharedPtr<FEditorPackageBatchJob> Pinned = WeakJob.Pin()) { Pinned->Cancel(); } }),
+            SNotificationItem::CS_Pending);
+        CancelButton.VisibilityOnNone = EVisibility::Visible;
+        Info.ButtonDetails.Add(CancelButton);
+
+        Job->NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
+        Job->UpdateNotificationState();
+    }
+
+    Jobs.Add(Job);
+
+    UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Submitted batch job '%s' (%d items)"), *DisplayName.ToString(), Job->NumItems);
+    return Job;
+}
+
+void FEditorPackageTimeSlicedRunner::Flush()
+{
+    check(IsInGameThread());
+
+    // -- 완료 콜백에서 새 작업을 제출할 수 있으므로 처리할 작업이 없을 때까지 반복
+    for (;;)
+    {
+        FinishCompletedJobs();
+
+        const TSharedRef<FEditorPackageBatchJob>* Next = Jobs.FindByPredicate([](const TSharedRef<FEditorPackageBatchJob>& Job)
+            {
+                return !Job->bPaused && !Job->bCanceled && Job->NumProcessed < Job->NumItems;
+            });
+        if (!Next)
+        {
+            break;
+        }
+
+        // -- 슬라이스 처리 중 Jobs가 바뀔 수 있으므로 참조를 유지
+        const TSharedRef<FEditorPackageBatchJob> Job = *Next;
+        ProcessJob(*Job, TNumericLimits<double>::Max());
+    }
+}
+
+void FEditorPackageTimeSlicedRunner::CancelAll()
+{
+    check(IsInGameThread());
+
+    for (const TSharedRef<FEditorPackageBatchJob>& Job : Jobs)
+    {
+        Job->Cancel();
+    }
+}
+
+/**
+ * 틱마다 작업을 처리하는 함수.
+ * 제출 순서대로 남은 예산 안에서 작업을 처리하고, 진행률을 노티피케이션에 표시한 뒤 끝난 작업을 정리합니다.
+ * 예산이 첫 작업의 한 슬라이스보다 작아도 틱마다 최소 한 슬라이스는 처리합니다.
+ */
+bool FEditorPackageTimeSlicedRunner::Tick(float DeltaTime)
+{
+    if (Jobs.Num() == 0)
+    {
+        return true;
+    }
+
+    EDITORPACKAGEUTILS_SCOPED_STAT(TimeSlicedRunnerTick);
+    check(IsInGameThread());
+
+    double RemainingSeconds = FMath::Max(FrameBudgetMs, 0.0) / 1000.0;
+    bool bProcessedAny = false;
+
+    // -- 슬라이스 처리 중에 새 작업을 제출할 수 있으므로 사본을 순회
+    const TArray<TSharedRef<FEditorPackageBatchJob>> CurrentJobs = Jobs;
+    for (const TSharedRef<FEditorPackageBatchJob>& Job : CurrentJobs)
+    {
+        if (Job->bPaused || Job->bCanceled || Job->NumProcessed >= Job->NumItems)
+        {
+            continue;
+        }
+        if (bProcessedAny && RemainingSeconds <= 0.0)
+        {
+            break;
+        }
+
+        RemainingSeconds -= ProcessJob(*Job, RemainingSeconds);
+        bProcessedAny = true;
+
+        if (Job->NotificationItem.IsValid())
+        {
+            Job->NotificationItem->SetSubText(EditorPackageTimeSlicedRunner::MakeProgressText(*Job));
+        }
+    }
+
+    FinishCompletedJobs();
+    return true;
+}
+
+/**
+ * 한 작업의 항목을 슬라이스 단위로 처리하는 함수.
+ * 슬라이스마다 걸린 시간으로 항목당 평균을 갱신하고, 평균으로 예상한 다음 항목 비용이 남은 예산보다 크면 멈춥니다.
+ * 첫 슬라이스는 예산과 관계없이 처리하므로 예산보다 비싼 항목도 틱마다 하나씩은 진행됩니다.
+ */
+double FEditorPackageTimeSlicedRunner::ProcessJob(FEditorPackageBatchJob& Job, double BudgetSeconds)
+{
+    using namespace EditorPackageTimeSlicedRunner;
+
+    const double StartTime = FPlatformTime::Seconds();
+    double ElapsedSeconds = 0.0;
+
+    do
+    {
+        const int32 SliceSize = GetSliceSize(Job, BudgetSeconds - ElapsedSeconds);
+
+        const double SliceStartTime = FPlatformTime::Seconds();
+        Job.ProcessSlice.ExecuteIfBound(Job.NumProcessed, SliceSize);
+        const double SliceSeconds = FPlatformTime::Seconds() - SliceStartTime;
+
+        Job.NumProcessed += SliceSize;
+        Job.ProcessSeconds += SliceSeconds;
+
+        const double ItemSeconds = SliceSeconds / SliceSize;
+        Job.AverageItemSeconds = Job.AverageItemSeconds > 0.0 ? FMath::Lerp(Job.AverageItemSeconds, ItemSeconds, SmoothingFactor) : ItemSeconds;
+
+        ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+    }
+    while (Job.NumProcessed < Job.NumItems && !Job.bPaused && !Job.bCanceled
+        && Job.AverageItemSeconds <= BudgetSeconds - ElapsedSeconds);
+
+    return ElapsedSeconds;
+}
+
+/**
+ * 다음 슬라이스의 항목 수를 정하는 함수.
+ * 아직 측정값이 없으면 항목 하나로 비용을 재고, 이후에는 남은 예산을 평균 항목 시간으로 나눈 만큼 처리합니다.
+ */
+int32 FEditorPackageTimeSlicedRunner::GetSliceSize(const FEditorPackageBatchJob& Job, double BudgetSeconds) const
+{
+    const int32 NumRemaining = Job.NumItems - Job.NumProcessed;
+    if (Job.AverageItemSeconds <= 0.0 || BudgetSeconds <= 0.0)
+    {
+        return FMath::Min(1, NumRemaining);
+    }
+
+    const double FittingItems = BudgetSeconds / Job.AverageItemSeconds;
+    const int32 SliceSize = FittingItems >= (double)MaxSliceSize ? MaxSliceSize : FMath::FloorToInt(FittingItems);
+    return FMath::Clamp(SliceSize, 1, FMath::Min(FMath::Max(MaxSliceSize, 1), NumRemaining));
+}
+
+void FEditorPackageTimeSlicedRunner::FinishCompletedJobs()
+{
+    // -- 완료 콜백에서 새 작업을 제출할 수 있으므로 목록에서 먼저 뺀 뒤 콜백 호출
+    TArray<TSharedRef<FEditorPackageBatchJob>> Completed;
+    for (int32 JobIndex = Jobs.Num() - 1; JobIndex >= 0; --JobIndex)
+    {
+        const TSharedRef<FEditorPackageBatchJob>& Job = Jobs[JobIndex];
+        if (Job->bCanceled || Job->NumProcessed >= Job->NumItems)
+        {
+            Completed.Insert(Job, 0);
+            Jobs.RemoveAt(JobIndex);
+        }
+    }
+
+    for (const TSharedRef<FEditorPackageBatchJob>& Job : Completed)
+    {
+        Job->bFinished = true;
+
+        FEditorPackageBatchJobResult Result;
+        Result.NumProcessed = Job->NumProcessed;
+        Result.NumItems = Job->NumItems;
+        Result.bCanceled = Job->bCanceled && Job->NumProcessed < Job->NumItems;
+        Result.ProcessSeconds = Job->ProcessSeconds;
+        Result.TotalSeconds = FPlatformTime::Seconds() - Job->SubmitTime;
+
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Batch job '%s' %s: %d/%d items, processing %.2fs, total %.2fs"),
+            *Job->DisplayName.ToString(), Result.bCanceled ? TEXT("canceled") : TEXT("completed"),
+            Result.NumProcessed, Result.NumItems, Result.ProcessSeconds, Result.TotalSeconds);
+
+        if (Job->NotificationItem.IsValid())
+        {
+            if (Result.bCanceled)
+            {
+                Job->NotificationItem->SetText(FText::Format(LOCTEXT("BatchJobCanceled", "{0} canceled."), Job->DisplayName));
+                Job->NotificationItem->SetCompletionState(SNotificationItem::CS_Fail);
+            }
+            else
+            {
+                Job->NotificationItem->SetText(FText::Format(LOCTEXT("BatchJobCompleted", "{0} completed."), Job->DisplayName));
+                Job->NotificationItem->SetCompletionState(SNotificationItem::CS_Success);
+            }
+            Job->NotificationItem->SetSubText(EditorPackageTimeSlicedRunner::MakeProgressText(*Job));
+            Job->NotificationItem->ExpireAndFadeout();
+            Job->NotificationItem.Reset();
+        }
+
+        // -- 완료 후에는 슬라이스 함수가 붙잡은 캡처를 해제
+        Job->ProcessSlice.Unbind();
+
+        FOnEditorPackageBatchJobFinished Callback = MoveTemp(Job->OnFinished);
+        Job->OnFinished.Unbind();
+        Callback.ExecuteIfBound(Result);
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
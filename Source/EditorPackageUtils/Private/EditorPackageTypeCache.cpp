@@ -0,0 +1,205 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageTypeCache.h"
+#include "EditorPackageUtilsLog.h"
+#include "EditorPackageUtilsStats.h"
+#include "Misc/StringBuilder.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Class.h"
+
+FEditorPackageTypeCache& FEditorPackageTypeCache::Get()
+{
+    static FEditorPackageTypeCache Instance;
+    return Instance;
+}
+
+void FEditorPackageTypeCache::Initialize()
+{
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FEditorPackageTypeCache::OnReloadComplete);
+    ReinstancingCompleteHandle = FCoreUObjectDelegates::ReloadReinstancingCompleteDelegate.AddRaw(this, &FEditorPackageTypeCache::OnReloadReinstancingComplete);
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FEditorPackageTypeCache::OnModulesChanged);
+}
+
+void FEditorPackageTypeCache::Shutdown()
+{
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    FCoreUObjectDelegates::ReloadReinstancingCompleteDelegate.Remove(ReinstancingCompleteHandle);
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+
+    ReloadCompleteHandle.Reset();
+    ReinstancingCompleteHandle.Reset();
+    ModulesChangedHandle.Reset();
+
+    Invalidate();
+    DiscardPersisted();
+}
+
+UScriptStruct* FEditorPackageTypeCache::FindStruct(FName ModuleName, FName StructName)
+{
+    return FindOrResolve(Structs, PersistedStructs, ModuleName, StructName);
+}
+
+UClass* FEditorPackageTypeCache::FindClass(FName ModuleName, FName ClassName)
+{
+    return FindOrResolve(Classes, PersistedClasses, ModuleName, ClassName);
+}
+
+void FEditorPackageTypeCache::Invalidate()
+{
+    Structs.Reset();
+    Classes.Reset();
+}
+
+void FEditorPackageTypeCache::ExportEntries(TArray<FPersistedEntry>& OutEntries) const
+{
+    OutEntries.Reset();
+    ExportCache(Structs, PersistedStructs, false, OutEntries);
+    ExportCache(Classes, PersistedClasses, true, OutEntries);
+}
+
+void FEditorPackageTypeCache::ImportEntries(TArrayView<const FPersistedEntry> Entries)
+{
+    DiscardPersisted();
+    for (const FPersistedEntry& Entry : Entries)
+    {
+        FPersistedMap& Persisted = Entry.bIsClass ? PersistedClasses : PersistedStructs;
+        Persisted.Add(TPair<FName, FName>(Entry.ModuleName, Entry.TypeName), Entry.Path);
+    }
+}
+
+void FEditorPackageTypeCache::DiscardPersisted()
+{
+    PersistedStructs.Reset();
+    PersistedClasses.Reset();
+}
+
+/**
+ * 현재 캐시의 결과를 먼저 내보내고, 이번 세션에서 조회하지 않은 이전 세션 결과를 이어서 내보내는 함수.
+ * GC로 사라진 타입은 경로를 알 수 없으므로 이전 세션 결과가 있을 때만 그 결과를 유지합니다.
+ */
+template <typename TType>
+void FEditorPackageTypeCache::ExportCache(const TTypeCacheMap<TType>& Cache, const FPersistedMap& Persisted, bool bIsClass, TArray<FPersistedEntry>& OutEntries)
+{
+    TSet<TPair<FName, FName>> Exported;
+    Exported.Reserve(Cache.Num());
+
+    for (const TPair<TPair<FName, FName>, TCacheEntry<TType>>& CacheEntry : Cache)
+    {
+        const TType* Type = CacheEntry.Value.Type.Get();
+        if (CacheEntry.Value.bFound && !Type)
+        {
+            continue;
+        }
+
+        FPersistedEntry& Entry = OutEntries.AddDefaulted_GetRef();
+        Entry.bIsClass = bIsClass;
+        Entry.ModuleName = CacheEntry.Key.Key;
+        Entry.TypeName = CacheEntry.Key.Value;
+        if (Type)
+        {
+            Entry.Path = Type->GetPathName();
+        }
+        Exported.Add(CacheEntry.Key);
+    }
+
+    for (const TPair<TPair<FName, FName>, FString>& PersistedEntry : Persisted)
+    {
+        if (!Exported.Contains(PersistedEntry.Key))
+        {
+            FPersistedEntry& Entry = OutEntries.AddDefaulted_GetRef();
+            Entry.bIsClass = bIsClass;
+            Entry.ModuleName = PersistedEntry.Key.Key;
+            Entry.TypeName = PersistedEntry.Key.Value;
+            Entry.Path = PersistedEntry.Value;
+        }
+    }
+}
+
+/**
+ * 캐시에서 타입을 찾고, 없으면 "/Script/ModuleName.TypeName" 경로로 타입을 찾아 캐시하는 함수.
+ * 이미 메모리에 있는 타입은 FindObject로 찾으며, 없을 때만 LoadObject로 로드를 시도합니다.
+ * 로그는 캐시 미스로 실제 조회가 일어났을 때만 남깁니다.
+ */
+template <typename TType>
+TType* FEditorPackageTypeCache::FindOrResolve(TTypeCacheMap<TType>& Cache, const FPersistedMap& Persisted, FName ModuleName, FName TypeName)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(ResolveTypeDefinition);
+    check(IsInGameThread());
+
+    const TPair<FName, FName> Key(ModuleName, TypeName);
+    if (const TCacheEntry<TType>* Entry = Cache.Find(Key))
+    {
+        if (!Entry->bFound)
+        {
+            return nullptr;
+        }
+        if (TType* CachedType = Entry->Type.Get())
+        {
+            return CachedType;
+        }
+    }
+
+    // -- 이전 세션에서 찾지 못한 타입은 같은 바이너리의 모듈이 로드되어 있으면 다시 찾지 않음
+    const FString* PersistedPath = Persisted.Find(Key);
+    if (PersistedPath && PersistedPath->IsEmpty() && FModuleManager::Get().IsModuleLoaded(ModuleName))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to load %s definition: %s from module: %s (cached)"), *TType::StaticClass()->GetName(), *TypeName.ToString(), *ModuleName.ToString());
+        TCacheEntry<TType>& NewEntry = Cache.FindOrAdd(Key);
+        NewEntry.Type = nullptr;
+        NewEntry.bFound = false;
+        return nullptr;
+    }
+
+    // -- 캐시 미스: 타입 경로를 만들고 메모리에서 먼저 조회
+    TStringBuilder<256> TypePath;
+    if (PersistedPath && !PersistedPath->IsEmpty())
+    {
+        TypePath << *PersistedPath;
+    }
+    else
+    {
+        TypePath << TEXT("/Script/") << ModuleName << TEXT('.') << TypeName;
+    }
+
+    TType* Type = FindObject<TType>(nullptr, *TypePath);
+    if (!Type)
+    {
+        Type = LoadObject<TType>(nullptr, *TypePath);
+    }
+
+    if (!Type)
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to load %s definition: %s from module: %s"), *TType::StaticClass()->GetName(), *TypeName.ToString(), *ModuleName.ToString());
+    }
+    else
+    {
+        UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Successfully loaded %s definition: %s from module: %s"), *TType::StaticClass()->GetName(), *TypeName.ToString(), *ModuleName.ToString());
+    }
+
+    TCacheEntry<TType>& NewEntry = Cache.FindOrAdd(Key);
+    NewEntry.Type = Type;
+    NewEntry.bFound = Type != nullptr;
+
+    return Type;
+}
+
+void FEditorPackageTypeCache::OnReloadComplete(EReloadCompleteReason Reason)
+{
+    // -- 바이너리가 바뀌었으므로 이전 세션 결과도 버림
+    Invalidate();
+    DiscardPersisted();
+}
+
+void FEditorPackageTypeCache::OnReloadReinstancingComplete()
+{
+    Invalidate();
+    DiscardPersisted();
+}
+
+void FEditorPackageTypeCache::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    // -- 새 모듈이 로드되면 이전에 실패한 조회가 성공할 수 있고, 언로드되면 타입이 사라짐
+    Invalidate();
+}
@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+
+/**
+ * (모듈명, 타입명) FName 쌍으로 리플렉션 타입(UScriptStruct, UClass)을 찾아 캐시합니다.
+ * 캐시 미스일 때만 FindObject로 이미 로드된 타입을 찾고, 그래도 없으면 LoadObject로 로드합니다.
+ * 찾지 못한 결과도 캐시하며, 핫 리로드나 라이브 코딩 재인스턴싱, 모듈 로드/언로드 시 전체 캐시를 비웁니다.
+ *
+ * 이전 세션의 조회 결과를 디스크 캐시(FEditorPackageMetadataCache)에서 가져올 수 있습니다.
+ * 가져온 결과 중 찾지 못한 타입은 모듈이 이미 로드되어 있으면 LoadObject 없이 바로 실패로 처리합니다.
+ * 가져온 결과는 바이너리가 바뀌는 핫 리로드와 재인스턴싱 때만 버립니다.
+ *
+ * @note 게임 스레드에서만 사용해야 합니다.
+ */
+class FEditorPackageTypeCache
+{
+public:
+    /** 디스크 캐시에 기록하는 조회 결과 하나. */
+    struct FPersistedEntry
+    {
+        bool bIsClass = false;
+        FName ModuleName;
+        FName TypeName;
+
+        /** 찾은 타입의 경로. 비어 있으면 찾지 못한 결과입니다. */
+        FString Path;
+    };
+
+    static FEditorPackageTypeCache& Get();
+
+    /** 리로드 및 모듈 변경 이벤트를 등록합니다. */
+    void Initialize();
+
+    /** 등록한 이벤트를 해제하고 캐시를 비웁니다. */
+    void Shutdown();
+
+    UScriptStruct* FindStruct(FName ModuleName, FName StructName);
+    UClass* FindClass(FName ModuleName, FName ClassName);
+
+    /** 캐시된 타입을 모두 버립니다. 이전 세션에서 가져온 결과는 유지합니다. */
+    void Invalidate();
+
+    /** 현재 캐시와 이전 세션에서 가져온 결과를 합쳐 내보냅니다. */
+    void ExportEntries(TArray<FPersistedEntry>& OutEntries) const;
+
+    /** 이전 세션의 조회 결과를 가져옵니다. 기존에 가져온 결과는 교체됩니다. */
+    void ImportEntries(TArrayView<const FPersistedEntry> Entries);
+
+    /** 이전 세션에서 가져온 결과를 버립니다. */
+    void DiscardPersisted();
+
+private:
+    template <typename TType>
+    struct TCacheEntry
+    {
+        TWeakObjectPtr<TType> Type;
+
+        /** 마지막 조회에서 타입을 찾았는지 여부. false이면 캐시된 실패 결과입니다. */
+        bool bFound = false;
+    };
+
+    template <typename TType>
+    using TTypeCacheMap = TMap<TPair<FName, FName>, TCacheEntry<TType>>;
+
+    /** (모듈명, 타입명) -> 이전 세션에서 찾은 경로. 빈 문자열이면 찾지 못한 결과. */
+    using FPersistedMap = TMap<TPair<FName, FName>, FString>;
+
+    template <typename TType>
+    static TType* FindOrResolve(TTypeCacheMap<TType>& Cache, const FPersistedMap& Persisted, FName ModuleName, FName TypeName);
+
+    template <typename TType>
+    static void ExportCache(const TTypeCacheMap<TType>& Cache, const FPersistedMap& Persisted, bool bIsClass, TArray<FPersistedEntry>& OutEntries);
+
+    void OnReloadComplete(EReloadCompleteReason Reason);
+    void OnReloadReinstancingComplete();
+    void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+
+    TTypeCacheMap<UScriptStruct> Structs;
+    TTypeCacheMap<UClass> Classes;
+
+    FPersistedMap PersistedStructs;
+    FPersistedMap PersistedClasses;
+
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle ReinstancingCompleteHandle;
+    FDelegateHandle ModulesChangedHandle;
+};
@@ -2,14 +2,286 @@
 
 
 #include "EditorPackageUtils.h"
+#include "EditorPackageMountTable.h"
+#include "EditorPackageAsyncSaveQueue.h"
+#include "EditorPackageDirectoryScanner.h"
+#include "EditorPackageBuildRunner.h"
+#include "EditorPackageFingerprintStore.h"
+#include "EditorPackageSaveProfiler.h"
+#include "EditorPackageSaveSession.h"
+#include "EditorPackageTimeSlicedRunner.h"
+#include "EditorPackageTypeCache.h"
+#include "EditorPackageUtilsLog.h"
+#include "EditorPackageUtilsStats.h"
+#include "EditorPackageUtilsPrivate.h"
 #include "UnrealEd.h"  // GUnrealEd 사용을 위해 필요
+#include "FileHelpers.h"
 #include <Misc/HotReloadInterface.h>
+#include "Misc/CompilationResult.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Modules/ModuleManager.h"
 #include "Interfaces/IPluginManager.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "UObject/SavePackage.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+#include "String/Find.h"
+
+UPackage* EditorPackageUtilsPrivate::FindOrCreatePackage(const FString& FullPackagePath)
+{
+    UPackage* ExistingPackage = FindPackage(nullptr, *FullPackagePath);
+    if (!ExistingPackage)
+    {
+        // -- 패키지 생성
+        ExistingPackage = CreatePackage(*FullPackagePath);
+        if (!ExistingPackage)
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to create package: %s"), *FullPackagePath);
+            return nullptr;
+        }
+        UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Package created: %s"), *FullPackagePath);
+    }
+
+    return ExistingPackage;
+}
+
+UPackage* EditorPackageUtilsPrivate::FindOrCreatePackageForAsset(UObject* SaveObject, const FString& FullPackagePath, const FString& FileName)
+{
+    UPackage* ExistingPackage = FindOrCreatePackage(FullPackagePath);
+    if (!ExistingPackage)
+    {
+        return nullptr;
+    }
+
+    // -- 이미 같은 위치에 있으면 이동하지 않음. 더티 표시는 호출자가 결정
+    if (SaveObject->GetOuter() != ExistingPackage || SaveObject->GetName() != FileName)
+    {
+        // -- 트랜지언트 패키지의 오브젝트는 참조하는 에셋이 없으므로 리디렉터와 Undo 기록이 필요 없음
+        ERenameFlags RenameFlags = REN_DoNotDirty;
+        if (SaveObject->GetPackage() == GetTransientPackage())
+        {
+            RenameFlags |= REN_DontCreateRedirectors | REN_NonTransactional;
+        }
+        SaveObject->Rename(*FileName, ExistingPackage, RenameFlags);
+    }
+
+    return ExistingPackage;
+}
+
+UPackage* EditorPackageUtilsPrivate::PrepareAssetForSave(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName, FString& OutFilePath, bool bMarkDirty, FEditorPackageSaveTiming* OutTiming)
+{
+    if (!SaveObject)
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("SaveObject is null!"));
+        return nullptr;
+    }
+
+    // -- 프로젝트의 콘텐츠 디렉터리 경로를 절대 경로로 변환
+    // SaveDirectory 에서 PackagePath 로 경로 변환
+    FString FullPackagePath;
+    {
+        FEditorPackageSavePhaseScope PhaseScope(OutTiming, EEditorPackageSavePhase::PathConversion);
+
+        FString RelativePath = EditorPackageUtils::ConvertFilePathToPackagePath(SaveDirectory);
+        UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Convert RelativePath: %s"), *RelativePath);
+        if (RelativePath.IsEmpty())
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("SaveDirectory is not inside any recognized content directory: %s (%s)"), *SaveDirectory, *RelativePath);
+            return nullptr;
+        }
+
+        // -- 패키지 경로에 SaveObject 이름을 추가하여 최종 패키지 경로를 생성
+        FullPackagePath = FPaths::Combine(RelativePath, FileName);
+        UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Full Package Path: %s"), *FullPackagePath);
+    }
+
+    // -- 패키지 생성
+    UPackage* ExistingPackage = nullptr;
+    {
+        FEditorPackageSavePhaseScope PhaseScope(OutTiming, EEditorPackageSavePhase::Rename);
+        ExistingPackage = FindOrCreatePackageForAsset(SaveObject, FullPackagePath, FileName);
+    }
+    if (!ExistingPackage)
+    {
+        return nullptr;
+    }
+
+    // -- Asset 등록 (이미 등록된 에셋을 다시 저장할 때는 알리지 않음)
+    {
+        FEditorPackageSavePhaseScope PhaseScope(OutTiming, EEditorPackageSavePhase::Registry);
+        if (EditorPackageUtils::IsAssetRegistered(FSoftObjectPath(SaveObject)) == false)
+        {
+            FAssetRegistryModule::AssetCreated(SaveObject);
+        }
+    }
+
+    // -- 패키지 저장
+    if (bMarkDirty)
+    {
+        SaveObject->MarkPackageDirty();
+    }
+
+    EnsureDirectoryExists(SaveDirectory);
+
+    OutFilePath = FPaths::Combine(SaveDirectory, FileName);
+    OutFilePath = EditorPackageUtils::EnsureUAssetExtension(OutFilePath);
+
+    return ExistingPackage;
+}
+
+FSavePackageArgs EditorPackageUtilsPrivate::MakeSaveArgs(uint32 SaveFlags)
+{
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = EObjectFlags::RF_Public | EObjectFlags::RF_Standalone;
+    SaveArgs.Error = GError;
+    SaveArgs.SaveFlags = SaveFlags;
+    SaveArgs.bForceByteSwapping = false;
+    SaveArgs.bWarnOfLongFilename = true;
+    return SaveArgs;
+}
+
+void EditorPackageUtilsPrivate::SavePackages(TArrayView<const FPackageSaveInfo> SaveInfos, uint32 SaveFlags, TArray<FSavePackageResultStruct>& OutResults, FEditorPackageSaveTiming* OutBatchTiming)
+{
+    OutResults.Reset();
+    OutResults.SetNum(SaveInfos.Num());
+
+    // -- 프로파일링 중에는 직렬화가 끝난 시점에 반환되도록 비동기로 기록하고, 파일 기록은 아래에서 따로 기다림
+    const bool bWaitForFileWrites = OutBatchTiming && (SaveFlags & SAVE_Async) == 0;
+    const FSavePackageArgs SaveArgs = MakeSaveArgs(OutBatchTiming ? SaveFlags | SAVE_Async : SaveFlags);
+
+    // -- 아래의 대기가 이 배치의 기록만 재도록 다른 호출자가 남긴 기록을 먼저 기다림
+    if (bWaitForFileWrites && UPackage::HasAsyncFileWrites())
+    {
+        FEditorPackageSavePhaseScope DrainScope(OutBatchTiming, EEditorPackageSavePhase::WriteDrain);
+        UPackage::WaitForAsyncFileWrites();
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    // -- 맵 패키지는 병렬 저장 경로를 사용할 수 없으므로 바로 순차 저장
+    TArray<FPackageSaveInfo> ConcurrentSaves;
+    TArray<int32> ConcurrentSaveIndices;
+    for (int32 SaveIndex = 0; SaveIndex < SaveInfos.Num(); ++SaveIndex)
+    {
+        const FPackageSaveInfo& SaveInfo = SaveInfos[SaveIndex];
+        if (SaveInfo.Package->ContainsMap())
+        {
+            OutResults[SaveIndex] = UPackage::Save(SaveInfo.Package, SaveInfo.Asset, *SaveInfo.Filename, SaveArgs);
+        }
+        else
+        {
+            ConcurrentSaves.Add(SaveInfo);
+            ConcurrentSaveIndices.Add(SaveIndex);
+        }
+    }
+
+    // -- 병렬 저장
+    if (ConcurrentSaves.Num() > 1)
+    {
+        TArray<FSavePackageResultStruct> ConcurrentResults;
+        UPackage::SaveConcurrent(ConcurrentSaves, SaveArgs, ConcurrentResults);
+
+        for (int32 Index = 0; Index < ConcurrentSaveIndices.Num() && Index < ConcurrentResults.Num(); ++Index)
+        {
+            OutResults[ConcurrentSaveIndices[Index]] = MoveTemp(ConcurrentResults[Index]);
+        }
+    }
+    else if (ConcurrentSaves.Num() == 1)
+    {
+        const FPackageSaveInfo& SaveInfo = ConcurrentSaves[0];
+        OutResults[ConcurrentSaveIndices[0]] = UPackage::Save(SaveInfo.Package, SaveInfo.Asset, *SaveInfo.Filename, SaveArgs);
+    }
+
+    if (OutBatchTiming)
+    {
+        OutBatchTiming->Add(EEditorPackageSavePhase::Serialization, FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    if (bWaitForFileWrites)
+    {
+        FEditorPackageSavePhaseScope FileIOScope(OutBatchTiming, EEditorPackageSavePhase::FileIO);
+        UPackage::WaitForAsyncFileWrites();
+    }
+}
+
+FSavePackageResultStruct EditorPackageUtilsPrivate::SavePackage(UPackage* Package, UObject* Asset, const FString& Filename, uint32 SaveFlags, FEditorPackageSaveTiming* OutTiming)
+{
+    const bool bWaitForFileWrites = OutTiming && (SaveFlags & SAVE_Async) == 0;
+
+    // -- 아래의 대기가 이 패키지의 기록만 재도록 다른 호출자가 남긴 기록을 먼저 기다림
+    if (bWaitForFileWrites && UPackage::HasAsyncFileWrites())
+    {
+        FEditorPackageSavePhaseScope DrainScope(OutTiming, EEditorPackageSavePhase::WriteDrain);
+        UPackage::WaitForAsyncFileWrites();
+    }
+
+    FSavePackageResultStruct SaveResult;
+    {
+        FEditorPackageSavePhaseScope PhaseScope(OutTiming, EEditorPackageSavePhase::Serialization);
+        const FSavePackageArgs SaveArgs = MakeSaveArgs(OutTiming ? SaveFlags | SAVE_Async : SaveFlags);
+        SaveResult = UPackage::Save(Package, Asset, *Filename, SaveArgs);
+    }
+
+    if (bWaitForFileWrites)
+    {
+        FEditorPackageSavePhaseScope PhaseScope(OutTiming, EEditorPackageSavePhase::FileIO);
+        UPackage::WaitForAsyncFileWrites();
+    }
+
+    return SaveResult;
+}
+
+IAssetRegistry& EditorPackageUtilsPrivate::GetAssetRegistry()
+{
+    // -- 모듈 매니저 조회는 처음 한 번만 수행
+    static IAssetRegistry* CachedAssetRegistry = nullptr;
+    if (!CachedAssetRegistry)
+    {
+        CachedAssetRegistry = &FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    }
+    return *CachedAssetRegistry;
+}
+
+void EditorPackageUtilsPrivate::EnsureDirectoryExists(const FString& Directory)
+{
+    // -- 저장 세션이 있으면 세션의 디렉터리 캐시 사용
+    if (FEditorPackageSaveSession* Session = FEditorPackageSaveSession::GetCurrent())
+    {
+        Session->EnsureDirectoryExists(Directory);
+        return;
+    }
+
+    if (!IFileManager::Get().DirectoryExists(*Directory))
+    {
+        IFileManager::Get().MakeDirectory(*Directory, true);
+        UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Created directory: %s"), *Directory);
+    }
+}
+
+bool EditorPackageUtilsPrivate::SaveDirtyPackages()
+{
+    // -- 소스 컨트롤 체크아웃, 읽기 전용 파일 처리, 맵 저장 훅을 거치도록 에디터 저장 경로 사용
+    const bool bSaved = FEditorFileUtils::SaveDirtyPackages(
+        /*bPromptUserToSave*/ false,
+        /*bSaveMapPackages*/ true,
+        /*bSaveContentPackages*/ true,
+        /*bFastSave*/ false,
+        /*bNotifyNoPackagesSaved*/ false,
+        /*bCanBeDeclined*/ false);
+
+    // -- 체크아웃을 거절했거나 디스크 파일이 없는 패키지는 더티로 남음
+    TArray<UPackage*> DirtyPackages;
+    FEditorFileUtils::GetDirtyWorldPackages(DirtyPackages);
+    FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+    for (const UPackage* Package : DirtyPackages)
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Dirty package was not saved: %s"), *Package->GetName());
+    }
+
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("Saved dirty packages (%d left unsaved)"), DirtyPackages.Num());
+    return bSaved && DirtyPackages.Num() == 0;
+}
 
 /**
  * 파일 경로에서 모듈명을 추출하는 함수.
@@ -20,19 +292,41 @@
  */
 FString EditorPackageUtils::ExtractModuleNameFromPath(const FString& FilePath)
 {
+    FStringView ModuleName;
+    ExtractModuleNameFromPath(FStringView(FilePath), ModuleName);
+    return FString(ModuleName);
+}
+
+/**
+ * 파일 경로에서 모듈명을 추출하는 함수. 결과는 FilePath를 가리키는 뷰이므로 힙 할당이 없습니다.
+ *
+ * @param FilePath 모듈명을 추출할 파일 경로.
+ * @param OutModuleName FilePath 안의 모듈명. 찾지 못하면 빈 뷰.
+ * @return 모듈명을 찾았으면 true.
+ */
+bool EditorPackageUtils::ExtractModuleNameFromPath(FStringView FilePath, FStringView& OutModuleName)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(ExtractModuleNameFromPath);
+
+    OutModuleName.Reset();
+
     // 경로에서 "Source" 이후의 경로 추출
-    FString PathAfterSource;
-    if (FilePath.Split(TEXT("/Source/"), nullptr, &PathAfterSource))
+    const int32 SourceIndex = UE::String::FindFirst(FilePath, TEXT("/Source/"), ESearchCase::IgnoreCase);
+    if (SourceIndex == INDEX_NONE)
     {
-        // "Source/" 이후의 첫 번째 폴더명을 모듈명으로 간주
-        FString ModuleName = PathAfterSource.Left(PathAfterSource.Find(TEXT("/")));
+        // 경로가 올바르지 않을 경우 빈 문자열 반환
+        return false;
+    }
 
-        // 모듈명 반환
-        return ModuleName;
+    // "Source/" 이후의 첫 번째 폴더명을 모듈명으로 간주
+    const FStringView PathAfterSource = FilePath.RightChop(SourceIndex + 8);
+    int32 SlashIndex;
+    if (PathAfterSource.FindChar(TEXT('/'), SlashIndex))
+    {
+        OutModuleName = PathAfterSource.Left(SlashIndex);
     }
 
-    // 경로가 올바르지 않을 경우 빈 문자열 반환
-    return FString();
+    return !OutModuleName.IsEmpty();
 }
 
 /**
@@ -43,6 +337,8 @@ FString EditorPackageUtils::ExtractModuleNameFromPath(const FString& FilePath)
  */
 FString EditorPackageUtils::EnsureUAssetExtension(const FString& FilePath)
 {
+    EDITORPACKAGEUTILS_SCOPED_STAT(EnsureUAssetExtension);
+
     // -- ".uasset" 확장자가 있는지 확인
     if (!FilePath.EndsWith(TEXT(".uasset")))
     {
@@ -55,434 +351,1290 @@ FString EditorPackageUtils::EnsureUAssetExtension(const FString& FilePath)
 }
 
 /**
- * 파일 시스템 경로를 Unreal Engine의 패키지 경로로 변환하는 함수.
- * 프로젝트의 콘텐츠 디렉터리 또는 플러그인의 콘텐츠 디렉터리에서 주어진 파일 시스템 경로를
- * Unreal Engine이 사용하는 패키지 경로로 변환합니다.
- * 예를 들어, "/Content/MyAsset/MyFile" 파일 시스템 경로는 "/Game/MyAsset/MyFile" 패키지 경로로,
- * 플러그인의 콘텐츠 경로는 "/PluginName/Content/MyAsset"으로 변환됩니다.
+ * .uasset 확장자가 붙은 경로를 OutFilePath 뒤에 덧붙이는 함수.
+ * 인라인 버퍼를 가진 TStringBuilder를 넘기면 힙 할당 없이 사용할 수 있습니다.
+ *
+ * @param FilePath 확인할 파일 경로.
+ * @param OutFilePath 결과를 덧붙일 빌더.
+ */
+void EditorPackageUtils::EnsureUAssetExtension(FStringView FilePath, FStringBuilderBase& OutFilePath)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(EnsureUAssetExtension);
+
+    OutFilePath << FilePath;
+
+    // -- ".uasset" 확장자가 없으면 추가
+    if (!FilePath.EndsWith(TEXT(".uasset"), ESearchCase::IgnoreCase))
+    {
+        OutFilePath << TEXT(".uasset");
+    }
+}
+
+/**
+ * 파일 시스템 경로를 Unreal Engine의 패키지 경로로 변환하는 함수.
+ * 프로젝트의 콘텐츠 디렉터리 또는 플러그인의 콘텐츠 디렉터리에서 주어진 파일 시스템 경로를
+ * Unreal Engine이 사용하는 패키지 경로로 변환합니다.
+ * 예를 들어, "/Content/MyAsset/MyFile" 파일 시스템 경로는 "/Game/MyAsset/MyFile" 패키지 경로로,
+ * 플러그인의 콘텐츠 경로는 "/PluginName/Content/MyAsset"으로 변환됩니다.
+ * 콘텐츠 루트 조회는 FEditorPackageMountTable을 사용하므로 대소문자와 구분자('/', '\')를 구분하지 않으며,
+ * 엔진 콘텐츠와 엔진 플러그인, 중첩 폴더에 있는 플러그인도 인식합니다.
+ *
+ * @param FilePath 실제 파일 시스템 경로. 예: "C:/Unreal Projects/YourProject/Content/MyAsset/MyFile"
+ * @return Unreal Engine 패키지 경로. 예: "/Game/MyAsset/MyFile" 또는 "/PluginName/Content/MyAsset/MyFile"
+ */
+FString EditorPackageUtils::ConvertFilePathToPackagePath(const FString& FilePath)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(ConvertFilePathToPackagePath);
+
+    // -- 프로젝트, 엔진, 플러그인 콘텐츠 디렉터리 마운트 테이블에서 조회
+    TStringBuilder<512> PackagePath;
+    if (FEditorPackageMountTable::Get().TryConvertFilenameToPackageName(FilePath, PackagePath))
+    {
+        UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Converted Package Path: %s"), PackagePath.ToString());
+        return FString(PackagePath.ToView());
+    }
+
+    // 경로가 인식되지 않으면 에러 로그 출력 및 빈 문자열 반환
+    UE_LOG(LogEditorPackageUtils, Error, TEXT("FilePath is not inside any recognized content or plugin directory: %s"), *FilePath);
+    return FString();
+}
+
+/**
+ * 여러 파일 시스템 경로를 한 번에 패키지 경로로 변환하는 함수.
+ * 항목이 많으면 FEditorPackageMountTable이 워커 스레드로 나눠 처리하며, 변환하지 못한 항목은 로그 없이 빈 문자열로 남깁니다.
+ *
+ * @param FilePaths 변환할 파일 시스템 경로 목록.
+ * @param OutPackagePaths FilePaths와 같은 순서의 패키지 경로.
+ * @return 변환한 항목 수.
+ */
+int32 EditorPackageUtils::ConvertFilePathsToPackagePaths(TArrayView<const FString> FilePaths, TArray<FString>& OutPackagePaths)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(ConvertFilePathsToPackagePaths);
+
+    return FEditorPackageMountTable::Get().ConvertFilenamesToPackageNames(FilePaths, OutPackagePaths);
+}
+
+/**
+ * 여러 패키지 경로를 한 번에 .uasset 파일 경로로 변환하는 함수.
+ * 마운트 테이블에 등록된 루트("/Game", "/Engine", "/PluginName")만 변환하며, 변환하지 못한 항목은 빈 문자열로 남깁니다.
+ *
+ * @param PackagePaths 변환할 패키지 경로 목록 (예: "/PluginName/MyFolder/MyAsset").
+ * @param OutFilePaths PackagePaths와 같은 순서의 파일 경로.
+ * @return 변환한 항목 수.
+ */
+int32 EditorPackageUtils::ConvertPackagePathsToFilePaths(TArrayView<const FString> PackagePaths, TArray<FString>& OutFilePaths)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(ConvertPackagePathsToFilePaths);
+
+    return FEditorPackageMountTable::Get().ConvertPackageNamesToFilenames(PackagePaths, OutFilePaths, TEXT(".uasset"));
+}
+
+/**
+ * 디렉터리 아래의 .uasset/.umap 파일을 모두 찾아 패키지 이름으로 변환하는 함수.
+ * 하위 트리를 워커 스레드에서 나눠 순회하고, 결과는 하나의 문자열 버퍼와 항목 배열로 반환합니다.
+ * 어떤 콘텐츠 루트에도 속하지 않는 파일은 제외하고 OutResult.NumUnconvertible에 셉니다.
+ *
+ * @param RootDirectory 스캔할 디렉터리 (예: "C:/Unreal Projects/YourProject/Plugins").
+ * @param OutResult 찾은 패키지 목록.
+ * @param bQueryRegistry true면 각 패키지의 Asset Registry 등록 여부를 한 번에 조회합니다.
+ * @return RootDirectory가 존재하면 true.
+ */
+bool EditorPackageUtils::ScanDirectoryForPackages(const FString& RootDirectory, FEditorPackageScanResult& OutResult, bool bQueryRegistry)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(ScanDirectoryForPackages);
+
+    return FEditorPackageDirectoryScanner::Scan(RootDirectory, OutResult, bQueryRegistry);
+}
+
+/**
+ * 언리얼 패키지 경로를 실제 파일 시스템 경로(.uasset)로 변환하는 함수.
+ * "/PluginName/..." 같은 실제 마운트 포인트와 "/Game/...", "/Engine/..."는 FEditorPackageMountTable의 루트 테이블로 변환하므로
+ * 엔진 플러그인과 중첩 폴더에 있는 플러그인도 올바른 콘텐츠 디렉터리로 변환됩니다.
+ * 이전 형식인 "/Game/Plugins/PluginName/..." 경로는 PluginName이 마운트된 플러그인이면 해당 플러그인의 콘텐츠 디렉터리를 기준으로 변환하고,
+ * 마운트되지 않은 플러그인이면 프로젝트 플러그인 디렉터리의 "Plugins/PluginName/Content/..."로 변환합니다.
+ * 등록되지 않은 루트는 FPackageName::TryConvertLongPackageNameToFilename 함수를 사용합니다.
+ *
+ * @param FullPackagePath 언리얼 패키지 경로 (예: "/PluginName/..." 또는 "/Game/Plugins/PluginName/...").
+ * @return Unreal 패키지 경로에 해당하는 실제 파일 시스템 경로 (예: "C:/Unreal Projects/YourProject/Plugins/PluginName/Content/.../Asset.uasset").
+ */
+FString EditorPackageUtils::PluginLongPackageNameToFilename(const FString& FullPackagePath)
+{
+    TStringBuilder<512> Filename;
+    if (!PluginLongPackageNameToFilename(FStringView(FullPackagePath), Filename))
+    {
+        return FString();
+    }
+    return FString(Filename.ToView());
+}
+
+/**
+ * PluginLongPackageNameToFilename의 결과를 OutFilename 뒤에 덧붙이는 함수.
+ * 마운트 테이블에 등록된 루트는 힙 할당 없이 변환합니다.
+ *
+ * @param FullPackagePath 언리얼 패키지 경로 (예: "/PluginName/..." 또는 "/Game/Plugins/PluginName/...").
+ * @param OutFilename 결과를 덧붙일 빌더.
+ * @return 변환에 성공하면 true.
+ */
+bool EditorPackageUtils::PluginLongPackageNameToFilename(FStringView FullPackagePath, FStringBuilderBase& OutFilename)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(PluginLongPackageNameToFilename);
+
+    // -- 두 번의 조회가 같은 시점의 테이블을 보도록 스냅샷 하나를 사용
+    const FEditorPackageMountSnapshotRef MountSnapshot = FEditorPackageMountTable::Get().GetSnapshot();
+
+    // -- 이전 형식 "/Game/Plugins/PluginName/RemainingPath"
+    const int32 PluginsIndex = UE::String::FindFirst(FullPackagePath, TEXT("/Plugins/"), ESearchCase::IgnoreCase);
+    if (PluginsIndex != INDEX_NONE)
+    {
+        // "/Plugins/" 이후를 "/PluginName/RemainingPath" 패키지 경로로 보고 플러그인 루트에서 조회
+        const FStringView PluginPackagePath = FullPackagePath.RightChop(PluginsIndex + 8);
+        if (MountSnapshot->TryConvertPackageNameToFilename(PluginPackagePath, OutFilename, TEXT(".uasset")))
+        {
+            return true;
+        }
+
+        // -- 마운트되지 않은 플러그인은 프로젝트 플러그인 디렉터리의 "PluginName/Content/RemainingPath"로 변환
+        const FStringView PluginRelativePath = PluginPackagePath.RightChop(1);
+        int32 SlashIndex;
+        if (!PluginRelativePath.FindChar(TEXT('/'), SlashIndex))
+        {
+            // 플러그인 이름 뒤에 경로가 없을 경우 에러 처리
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Invalid plugin path: %.*s"), FullPackagePath.Len(), FullPackagePath.GetData());
+            return false;
+        }
+
+        const FString PluginsDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectPluginsDir());
+        OutFilename << PluginsDir;
+        if (!PluginsDir.EndsWith(TEXT("/")))
+        {
+            OutFilename << TEXT('/');
+        }
+        OutFilename << PluginRelativePath.Left(SlashIndex) << TEXT("/Content/") << PluginRelativePath.RightChop(SlashIndex + 1) << TEXT(".uasset");
+        return true;
+    }
+
+    // -- "/RootName/RemainingPath" 형식의 마운트 포인트
+    if (MountSnapshot->TryConvertPackageNameToFilename(FullPackagePath, OutFilename, TEXT(".uasset")))
+    {
+        return true;
+    }
+
+    // 등록되지 않은 루트는 기본적인 Unreal 방식으로 경로를 변환
+    FString Filename;
+    if (!FPackageName::TryConvertLongPackageNameToFilename(FString(FullPackagePath), Filename, FPackageName::GetAssetPackageExtension()))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Package path does not map to any content root: %.*s"), FullPackagePath.Len(), FullPackagePath.GetData());
+        return false;
+    }
+    OutFilename << Filename;
+    return true;
+}
+
+/**
+ * 주어진 에셋 경로를 기준으로 에셋이 이미 Asset Registry에 등록되어 있는지 확인하는 함수.
+ * 오브젝트 이름이 없는 패키지 경로가 주어지면 패키지 이름과 같은 이름의 에셋("/Game/MyFolder/MyAsset.MyAsset")을 확인합니다.
+ *
+ * @param AssetPath 확인할 에셋의 경로 (예: "/Game/MyFolder/MyAsset" 또는 "/Game/MyFolder/MyAsset.MyAsset").
+ * @return 에셋이 이미 등록되어 있으면 true, 그렇지 않으면 false를 반환.
+ */
+bool EditorPackageUtils::IsAssetAlreadyRegistered(const FString& AssetPath)
+{
+    // -- 패키지 경로만 주어진 경우 오브젝트 경로로 보정
+    int32 DotIndex;
+    if (!AssetPath.FindChar(TEXT('.'), DotIndex))
+    {
+        const FString AssetName = FPackageName::GetShortName(AssetPath);
+        return IsAssetRegistered(FSoftObjectPath(FTopLevelAssetPath(FName(*AssetPath), FName(*AssetName))));
+    }
+
+    return IsAssetRegistered(FSoftObjectPath(AssetPath));
+}
+
+/**
+ * 오브젝트 경로로 에셋이 Asset Registry에 등록되어 있는지 확인하는 함수.
+ * FAssetData를 복사하지 않고 레지스트리에 저장된 데이터를 열거하기만 하므로 GetAssetByObjectPath보다 가볍습니다.
+ * 메모리에만 있고 AssetCreated로 알려지지 않은 오브젝트는 등록된 것으로 보지 않습니다.
+ *
+ * @param ObjectPath 확인할 에셋의 오브젝트 경로 (예: "/Game/MyFolder/MyAsset.MyAsset").
+ * @return 에셋이 이미 등록되어 있으면 true.
+ */
+bool EditorPackageUtils::IsAssetRegistered(const FSoftObjectPath& ObjectPath)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(IsAssetRegistered);
+    check(IsInGameThread());
+
+    if (ObjectPath.IsNull())
+    {
+        return false;
+    }
+
+    FARFilter Filter;
+    Filter.SoftObjectPaths.Add(ObjectPath);
+    Filter.bIncludeOnlyOnDiskAssets = true;
+
+    bool bRegistered = false;
+    EditorPackageUtilsPrivate::GetAssetRegistry().EnumerateAssets(Filter, [&bRegistered](const FAssetData&)
+        {
+            bRegistered = true;
+            return false;
+        });
+
+    return bRegistered;
+}
+
+/**
+ * 여러 에셋의 등록 여부를 Asset Registry 호출 한 번으로 확인하는 함수.
+ *
+ * @param ObjectPaths 확인할 에셋의 오브젝트 경로 목록.
+ * @param OutRegistered ObjectPaths와 같은 순서의 등록 여부.
+ * @return 등록되어 있는 에셋 수.
+ */
+int32 EditorPackageUtils::AreAssetsRegistered(TArrayView<const FSoftObjectPath> ObjectPaths, TBitArray<>& OutRegistered)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(AreAssetsRegistered);
+    check(IsInGameThread());
+
+    OutRegistered.Init(false, ObjectPaths.Num());
+    if (ObjectPaths.Num() == 0)
+    {
+        return 0;
+    }
+
+    // -- 경로 -> 인덱스 (같은 경로가 여러 번 주어질 수 있음)
+    TMultiMap<FSoftObjectPath, int32> PathToIndex;
+    PathToIndex.Reserve(ObjectPaths.Num());
+
+    FARFilter Filter;
+    Filter.SoftObjectPaths.Reserve(ObjectPaths.Num());
+    Filter.bIncludeOnlyOnDiskAssets = true;
+
+    for (int32 Index = 0; Index < ObjectPaths.Num(); ++Index)
+    {
+        if (!ObjectPaths[Index].IsNull())
+        {
+            PathToIndex.Add(ObjectPaths[Index], Index);
+            Filter.SoftObjectPaths.Add(ObjectPaths[Index]);
+        }
+    }
+
+    int32 NumRegistered = 0;
+    EditorPackageUtilsPrivate::GetAssetRegistry().EnumerateAssets(Filter, [&PathToIndex, &OutRegistered, &NumRegistered](const FAssetData& AssetData)
+        {
+            for (auto It = PathToIndex.CreateConstKeyIterator(AssetData.GetSoftObjectPath()); It; ++It)
+            {
+                if (!OutRegistered[It.Value()])
+                {
+                    OutRegistered[It.Value()] = true;
+                    ++NumRegistered;
+                }
+            }
+            return true;
+        });
+
+    return NumRegistered;
+}
+
+/**
+ * 동적으로 모듈명과 구조체명을 기반으로 구조체 정의(타입 정보)를 로드합니다.
+ * 이 함수는 구조체의 인스턴스가 아닌, 해당 구조체의 정의를 로드합니다.
+ * 한 번 찾은 결과는 FEditorPackageTypeCache에 캐시되며, 핫 리로드 시 무효화됩니다.
+ *
+ * @param ModuleName 로드할 구조체가 속한 모듈의 이름.
+ * @param StructName 로드할 구조체의 이름.
+ * @return UScriptStruct* 구조체의 정의가 성공적으로 로드되면 해당 구조체의 포인터를 반환, 실패하면 nullptr을 반환.
+ */
+UScriptStruct* EditorPackageUtils::LoadStructDefinitionByName(const FString& ModuleName, const FString& StructName)
+{
+    return ResolveStructDefinition(FName(*ModuleName), FName(*StructName));
+}
+
+/**
+ * 동적으로 모듈명과 클래스명을 기반으로 클래스 정의(타입 정보)를 로드합니다.
+ * 이 함수는 클래스 인스턴스가 아닌, 해당 클래스의 정의를 로드합니다.
+ * 한 번 찾은 결과는 FEditorPackageTypeCache에 캐시되며, 핫 리로드 시 무효화됩니다.
+ *
+ * @param ModuleName 로드할 클래스가 속한 모듈의 이름.
+ * @param ClassName 로드할 클래스의 이름.
+ * @return UClass* 클래스 정의가 성공적으로 로드되면 해당 클래스의 포인터를 반환, 실패하면 nullptr을 반환.
+ */
+UClass* EditorPackageUtils::LoadClassDefinitionByName(const FString& ModuleName, const FString& ClassName)
+{
+    return ResolveClassDefinition(FName(*ModuleName), FName(*ClassName));
+}
+
+/**
+ * FName 모듈명과 구조체명으로 캐시된 구조체 정의를 찾는 함수.
+ * 문자열 변환 없이 캐시를 조회하므로 같은 타입을 반복해서 찾는 경우 LoadStructDefinitionByName보다 빠릅니다.
+ *
+ * @param ModuleName 구조체가 속한 모듈의 이름.
+ * @param StructName 구조체의 이름.
+ * @return 구조체 정의. 찾지 못하면 nullptr.
+ */
+UScriptStruct* EditorPackageUtils::ResolveStructDefinition(FName ModuleName, FName StructName)
+{
+    check(IsInGameThread());
+
+    return FEditorPackageTypeCache::Get().FindStruct(ModuleName, StructName);
+}
+
+/**
+ * FName 모듈명과 클래스명으로 캐시된 클래스 정의를 찾는 함수.
+ *
+ * @param ModuleName 클래스가 속한 모듈의 이름.
+ * @param ClassName 클래스의 이름.
+ * @return 클래스 정의. 찾지 못하면 nullptr.
+ */
+UClass* EditorPackageUtils::ResolveClassDefinition(FName ModuleName, FName ClassName)
+{
+    check(IsInGameThread());
+
+    return FEditorPackageTypeCache::Get().FindClass(ModuleName, ClassName);
+}
+
+/**
+ * 한 모듈에 속한 여러 구조체 정의를 한 번에 찾는 함수.
+ *
+ * @param ModuleName 구조체들이 속한 모듈의 이름.
+ * @param StructNames 찾을 구조체 이름 목록.
+ * @param OutStructs StructNames와 같은 순서의 구조체 정의. 찾지 못한 항목은 nullptr.
+ * @return 찾은 구조체 수.
+ */
+int32 EditorPackageUtils::ResolveStructDefinitions(FName ModuleName, TArrayView<const FName> StructNames, TArray<UScriptStruct*>& OutStructs)
+{
+    check(IsInGameThread());
+
+    FEditorPackageTypeCache& TypeCache = FEditorPackageTypeCache::Get();
+
+    int32 NumResolved = 0;
+    OutStructs.Reset(StructNames.Num());
+    for (const FName StructName : StructNames)
+    {
+        UScriptStruct* Struct = TypeCache.FindStruct(ModuleName, StructName);
+        NumResolved += Struct ? 1 : 0;
+        OutStructs.Add(Struct);
+    }
+    return NumResolved;
+}
+
+/**
+ * 한 모듈에 속한 여러 클래스 정의를 한 번에 찾는 함수.
+ *
+ * @param ModuleName 클래스들이 속한 모듈의 이름.
+ * @param ClassNames 찾을 클래스 이름 목록.
+ * @param OutClasses ClassNames와 같은 순서의 클래스 정의. 찾지 못한 항목은 nullptr.
+ * @return 찾은 클래스 수.
+ */
+int32 EditorPackageUtils::ResolveClassDefinitions(FName ModuleName, TArrayView<const FName> ClassNames, TArray<UClass*>& OutClasses)
+{
+    check(IsInGameThread());
+
+    FEditorPackageTypeCache& TypeCache = FEditorPackageTypeCache::Get();
+
+    int32 NumResolved = 0;
+    OutClasses.Reset(ClassNames.Num());
+    for (const FName ClassName : ClassNames)
+    {
+        UClass* Class = TypeCache.FindClass(ModuleName, ClassName);
+        NumResolved += Class ? 1 : 0;
+        OutClasses.Add(Class);
+    }
+    return NumResolved;
+}
+
+namespace EditorPackageUtilsBuild
+{
+    /** 완료 상태의 노티피케이션을 잠시 표시합니다. */
+    static void ShowCompletionNotification(const FString& Message, bool bSuccess)
+    {
+        FNotificationInfo Info(FText::FromString(Message));
+        Info.ExpireDuration = 4.0f;
+        Info.bUseSuccessFailIcons = true;
+
+        TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
+        if (NotificationItem.IsValid())
+        {
+            NotificationItem->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+        }
+    }
+
+    /** 진행 중 상태의 노티피케이션을 표시합니다. */
+    static TSharedPtr<SNotificationItem> ShowPendingNotification(const FString& Message)
+    {
+        FNotificationInfo Info(FText::FromString(Message));
+        Info.bFireAndForget = false;  // 자동으로 사라지지 않도록 설정
+        Info.FadeOutDuration = 0.5f;
+        Info.ExpireDuration = 0.0f;
+        Info.bUseThrobber = true;  // 계속 도는 아이콘 사용
+        Info.bUseSuccessFailIcons = true;
+
+        TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
+        if (NotificationItem.IsValid())
+        {
+            NotificationItem->SetCompletionState(SNotificationItem::CS_Pending);  // 진행 중 상태로 설정
+        }
+        return NotificationItem;
+    }
+
+    /** 진행 중 노티피케이션을 결과 상태로 바꾸고 서서히 사라지게 합니다. */
+    static void CompleteNotification(const TSharedPtr<SNotificationItem>& NotificationItem, const FString& Message, const FString& SubText, bool bSuccess)
+    {
+        if (NotificationItem.IsValid())
+        {
+            NotificationItem->SetText(FText::FromString(Message));
+            NotificationItem->SetSubText(FText::FromString(SubText));
+            NotificationItem->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+            NotificationItem->ExpireAndFadeout();  // 완료 후 알림을 서서히 사라지게 함
+        }
+    }
+
+    static bool IsCompileSuccessful(ECompilationResult::Type Result)
+    {
+        return Result == ECompilationResult::Succeeded || Result == ECompilationResult::UpToDate;
+    }
+
+    /** Live Coding이 켜져 있거나 이미 컴파일 중이면 실패 노티피케이션을 표시하고 false를 반환합니다. */
+    static bool CanStartHotReload(IHotReloadInterface& HotReload)
+    {
+        if (FEditorPackageBuildRunner::IsLiveCodingEnabled())
+        {
+            UE_LOG(LogEditorPackageUtils, Warning, TEXT("Live Coding is enabled for this session. Hot reload is not available."));
+            ShowCompletionNotification(TEXT("Live Coding is enabled. Use Live Coding or disable it to hot reload."), false);
+            return false;
+        }
+
+        if (HotReload.IsCurrentlyCompiling())
+        {
+            UE_LOG(LogEditorPackageUtils, Warning, TEXT("A module compile is already in progress. Hot reload skipped."));
+            ShowCompletionNotification(TEXT("A compile is already in progress."), false);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * 소스와 바이너리가 마지막으로 성공한 빌드 그대로인지 확인합니다. 그대로면 노티피케이션을 표시합니다.
+     *
+     * @param OutSourceFingerprint 현재 소스 지문. 컴파일에 성공하면 기록에 사용합니다.
+     * @return 컴파일할 필요가 없으면 true.
+     */
+    static bool IsHotReloadUpToDate(uint64& OutSourceFingerprint)
+    {
+        const double CheckStartTime = FPlatformTime::Seconds();
+        OutSourceFingerprint = FEditorPackageBuildRunner::ComputeSourceFingerprint();
+        const uint64 BinaryFingerprint = FEditorPackageBuildRunner::ComputeBinaryFingerprint();
+        const double CheckSeconds = FPlatformTime::Seconds() - CheckStartTime;
+
+        if (!FEditorPackageBuildRunner::Get().IsBuildUpToDate(OutSourceFingerprint, BinaryFingerprint))
+        {
+            return false;
+        }
+
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Sources unchanged since the last successful build. Hot reload skipped. (check %.2fs)"), CheckSeconds);
+        ShowCompletionNotification(TEXT("Modules are up to date. Hot reload skipped."), true);
+        return true;
+    }
+}
+
+/**
+ * 게임 모듈을 컴파일하고 핫 리로드하는 함수.
+ * 소스와 바이너리가 마지막으로 성공한 빌드 그대로면 컴파일과 리로드를 건너뜁니다.
+ * 그렇지 않으면 DoHotReloadFromEditor로 게임 모듈을 한 번만 컴파일해 바로 로드하고, 컴파일 결과로 성공 여부를 판단합니다.
+ * 컴파일 중에는 상태를 알리기 위한 노티피케이션을 표시합니다.
+ *
+ * @note 컴파일과 리로드가 끝날 때까지 게임 스레드가 멈춥니다. 에디터를 멈추지 않으려면 ExecuteBuildAndHotReloadAsync를 사용하세요.
+ */
+void EditorPackageUtils::ExecuteBuildAndHotReload()
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(ExecuteBuildAndHotReload);
+    check(IsInGameThread());
+
+    IHotReloadInterface& HotReload = FModuleManager::LoadModuleChecked<IHotReloadInterface>("HotReload");
+    if (!EditorPackageUtilsBuild::CanStartHotReload(HotReload))
+    {
+        return;
+    }
+
+    uint64 SourceFingerprint = 0;
+    if (EditorPackageUtilsBuild::IsHotReloadUpToDate(SourceFingerprint))
+    {
+        return;
+    }
+
+    TSharedPtr<SNotificationItem> NotificationItem = EditorPackageUtilsBuild::ShowPendingNotification(TEXT("Build in progress..."));
+
+    // 컴파일과 핫 리로드 (게임 모듈을 한 번 컴파일한 뒤 바로 로드)
+    const double ReloadStartTime = FPlatformTime::Seconds();
+    const ECompilationResult::Type CompileResult = HotReload.DoHotReloadFromEditor(EHotReloadFlags::WaitForCompletion);
+    const double ReloadSeconds = FPlatformTime::Seconds() - ReloadStartTime;
+
+    const bool bSucceeded = EditorPackageUtilsBuild::IsCompileSuccessful(CompileResult);
+    if (bSucceeded)
+    {
+        FEditorPackageBuildRunner::Get().RecordSuccessfulBuild(SourceFingerprint, FEditorPackageBuildRunner::ComputeBinaryFingerprint());
+    }
+
+    EditorPackageUtilsBuild::CompleteNotification(NotificationItem,
+        bSucceeded ? TEXT("Build completed successfully!") : TEXT("Build failed!"),
+        FString::Printf(TEXT("%s, %.1f s"), ECompilationResult::ToString(CompileResult), ReloadSeconds),
+        bSucceeded);
+
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("Build and hot reload %s (%s). Compile + reload %.2fs"),
+        bSucceeded ? TEXT("finished") : TEXT("failed"), ECompilationResult::ToString(CompileResult), ReloadSeconds);
+}
+
+/**
+ * 에디터를 멈추지 않고 게임 모듈을 컴파일한 뒤 핫 리로드하는 함수.
+ * 1) 소스와 바이너리가 마지막으로 성공한 빌드 그대로면 컴파일과 리로드를 건너뜁니다.
+ * 2) DoHotReloadFromEditor로 게임 모듈을 백그라운드에서 한 번만 컴파일하고, 컴파일이 끝나면 엔진이 바로 로드합니다.
+ * 3) 컴파일이 실패하거나 바뀐 것이 없으면 리로드 없이 종료합니다.
+ * 4) 리로드가 끝나면 컴파일과 리로드에 걸린 시간을 따로 로그에 남깁니다.
+ */
+void EditorPackageUtils::ExecuteBuildAndHotReloadAsync()
+{
+    check(IsInGameThread());
+
+    IHotReloadInterface& HotReload = FModuleManager::LoadModuleChecked<IHotReloadInterface>("HotReload");
+    if (!EditorPackageUtilsBuild::CanStartHotReload(HotReload))
+    {
+        return;
+    }
+
+    uint64 SourceFingerprint = 0;
+    if (EditorPackageUtilsBuild::IsHotReloadUpToDate(SourceFingerprint))
+    {
+        return;
+    }
+
+    // -- 컴파일 완료와 리로드 완료 이벤트로 단계별 시간 기록
+    struct FHotReloadState
+    {
+        TSharedPtr<SNotificationItem> NotificationItem;
+        double StartTime = 0.0;
+        double CompileSeconds = 0.0;
+        FDelegateHandle CompileHandle;
+        FDelegateHandle ReloadHandle;
+
+        void RemoveHandlers() const
+        {
+            if (IHotReloadInterface* HotReloadModule = FModuleManager::GetModulePtr<IHotReloadInterface>("HotReload"))
+            {
+                HotReloadModule->OnModuleCompilerFinished().Remove(CompileHandle);
+                HotReloadModule->OnHotReload().Remove(ReloadHandle);
+            }
+        }
+    };
+
+    TSharedRef<FHotReloadState> State = MakeShared<FHotReloadState>();
+    State->NotificationItem = EditorPackageUtilsBuild::ShowPendingNotification(TEXT("Compiling..."));
+    State->StartTime = FPlatformTime::Seconds();
+
+    State->CompileHandle = HotReload.OnModuleCompilerFinished().AddLambda([State, SourceFingerprint](const FString& CompilerLog, ECompilationResult::Type CompileResult, bool bShowLog)
+        {
+            State->CompileSeconds = FPlatformTime::Seconds() - State->StartTime;
+
+            if (!EditorPackageUtilsBuild::IsCompileSuccessful(CompileResult))
+            {
+                UE_LOG(LogEditorPackageUtils, Warning, TEXT("Compile did not succeed (%s). Hot reload skipped. (compile %.2fs)"), ECompilationResult::ToString(CompileResult), State->CompileSeconds);
+                EditorPackageUtilsBuild::CompleteNotification(State->NotificationItem, TEXT("Build failed!"), ECompilationResult::ToString(CompileResult), false);
+                State->RemoveHandlers();
+                return;
+            }
+
+            FEditorPackageBuildRunner::Get().RecordSuccessfulBuild(SourceFingerprint, FEditorPackageBuildRunner::ComputeBinaryFingerprint());
+
+            // -- 바뀐 것이 없으면 리로드되지 않으므로 여기서 마침
+            if (CompileResult == ECompilationResult::UpToDate)
+            {
+                UE_LOG(LogEditorPackageUtils, Log, TEXT("Modules are up to date. Hot reload skipped. (compile %.2fs)"), State->CompileSeconds);
+                EditorPackageUtilsBuild::CompleteNotification(State->NotificationItem, TEXT("Modules are up to date."), FString::Printf(TEXT("%.1f s"), State->CompileSeconds), true);
+                State->RemoveHandlers();
+            }
+        });
+
+    State->ReloadHandle = HotReload.OnHotReload().AddLambda([State](bool bWasTriggeredAutomatically)
+        {
+            const double TotalSeconds = FPlatformTime::Seconds() - State->StartTime;
+            UE_LOG(LogEditorPackageUtils, Log, TEXT("Build and hot reload finished. Compile %.2fs, reload %.2fs, total %.2fs"),
+                State->CompileSeconds, TotalSeconds - State->CompileSeconds, TotalSeconds);
+            EditorPackageUtilsBuild::CompleteNotification(State->NotificationItem, TEXT("Build completed successfully!"), FString::Printf(TEXT("%.1f s"), TotalSeconds), true);
+            State->RemoveHandlers();
+        });
+
+    HotReload.DoHotReloadFromEditor(EHotReloadFlags::None);
+}
+
+namespace EditorPackageUtilsRestart
+{
+    /**
+     * 바이너리가 이 세션이 로드한 것과 다를 때만 더티 패키지를 저장하고 에디터를 다시 시작합니다.
+     * 저장에 실패한 패키지가 있으면 작업을 잃지 않도록 재시작하지 않습니다.
+     */
+    static void RestartIfBinariesChanged(const FString& ProjectPath, uint64 BinaryFingerprint)
+    {
+        if (BinaryFingerprint == FEditorPackageBuildRunner::Get().GetSessionBinaryFingerprint())
+        {
+            UE_LOG(LogEditorPackageUtils, Log, TEXT("Binaries match the running editor. Restart skipped."));
+            EditorPackageUtilsBuild::ShowCompletionNotification(TEXT("Binaries are up to date. Restart skipped."), true);
+            return;
+        }
+
+        const double SaveStartTime = FPlatformTime::Seconds();
+        if (!EditorPackageUtilsPrivate::SaveDirtyPackages())
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Some dirty packages could not be saved. Restart canceled."));
+            EditorPackageUtilsBuild::ShowCompletionNotification(TEXT("Failed to save dirty packages. Restart canceled."), false);
+            return;
+        }
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Saved dirty packages in %.2fs. Restarting editor."), FPlatformTime::Seconds() - SaveStartTime);
+
+        EditorPackageUtils::RestartEditorWithProject(ProjectPath);
+    }
+}
+
+/**
+ * 필요할 때만 빌드하고, 바이너리가 바뀌었을 때만 에디터를 다시 시작하는 함수.
+ * 1) 소스와 바이너리 지문이 마지막으로 성공한 빌드와 같으면 UnrealBuildTool 실행을 건너뜁니다.
+ * 2) 그렇지 않으면 FEditorPackageBuildRunner로 에디터 타깃을 비동기 컴파일하고, 성공하면 빌드 지문을 기록합니다.
+ *    Live Coding이 켜져 있으면 UBT가 실행 중인 에디터 타깃을 빌드하지 않으므로 빌드하지 않고 알립니다.
+ *    이미 빌드 중이거나 UBT를 시작하지 못해도 실패 노티피케이션을 표시합니다.
+ * 3) 바이너리가 현재 에디터가 로드한 것과 같으면 재시작하지 않습니다.
+ * 4) 다르면 에디터 저장 경로(FEditorFileUtils)로 더티 패키지를 저장한 뒤 에디터를 다시 시작합니다. 저장에 실패하면 재시작을 취소합니다.
+ *
+ * @note 빌드 프로세스는 비동기적으로 실행되며, 에디터는 빌드 중에도 멈추지 않습니다.
+ */
+void EditorPackageUtils::StartBuildAndRestartEditor()
+{
+    check(IsInGameThread());
+
+    // 프로젝트 경로
+    const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+    UE_LOG(LogEditorPackageUtils, Log, TEXT("ProjectPath: %s"), *ProjectPath);
+
+    // -- 소스와 바이너리가 마지막 빌드 그대로면 UBT 생략
+    const double CheckStartTime = FPlatformTime::Seconds();
+    const uint64 SourceFingerprint = FEditorPackageBuildRunner::ComputeSourceFingerprint();
+    const uint64 BinaryFingerprint = FEditorPackageBuildRunner::ComputeBinaryFingerprint();
+    const double CheckSeconds = FPlatformTime::Seconds() - CheckStartTime;
+
+    if (FEditorPackageBuildRunner::Get().IsBuildUpToDate(SourceFingerprint, BinaryFingerprint))
+    {
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Sources unchanged since the last successful build, skipping UnrealBuildTool. (check %.2fs)"), CheckSeconds);
+        EditorPackageUtilsRestart::RestartIfBinariesChanged(ProjectPath, BinaryFingerprint);
+        return;
+    }
+
+    // -- Live Coding 세션에서는 UBT가 실행 중인 에디터 타깃의 빌드를 거부하므로 빌드 실패로 보이지 않게 먼저 알림
+    if (FEditorPackageBuildRunner::IsLiveCodingEnabled())
+    {
+        UE_LOG(LogEditorPackageUtils, Warning, TEXT("Live Coding is enabled for this session. UnrealBuildTool cannot build the running editor target. Restart skipped."));
+        EditorPackageUtilsBuild::ShowCompletionNotification(TEXT("Live Coding is enabled. Use Live Coding or disable it to build and restart."), false);
+        return;
+    }
+
+    FEditorPackageBuildRunner& BuildRunner = FEditorPackageBuildRunner::Get();
+    const bool bStarted = BuildRunner.StartBuild(FEditorPackageBuildRunner::MakeEditorTargetArguments(), FText::FromString(TEXT("Compiling...")),
+        FOnEditorPackageBuildFinished::CreateLambda([ProjectPath, SourceFingerprint](const FEditorPackageBuildResult& Result)
+            {
+                if (!Result.bSuccess)
+                {
+                    UE_LOG(LogEditorPackageUtils, Warning, TEXT("Build did not succeed. Restart skipped. (compile %.2fs)"), Result.CompileSeconds);
+                    return;
+                }
+
+                // -- 빌드 중 바뀐 소스는 다음 빌드에서 잡히도록 시작 시점의 소스 지문을 기록
+                const uint64 NewBinaryFingerprint = FEditorPackageBuildRunner::ComputeBinaryFingerprint();
+                FEditorPackageBuildRunner::Get().RecordSuccessfulBuild(SourceFingerprint, NewBinaryFingerprint);
+
+                EditorPackageUtilsRestart::RestartIfBinariesChanged(ProjectPath, NewBinaryFingerprint);
+            }));
+
+    // -- 시작하지 못하면 StartBuild가 노티피케이션을 띄우지 않으므로 여기서 알림
+    if (!bStarted)
+    {
+        if (BuildRunner.IsRunning())
+        {
+            UE_LOG(LogEditorPackageUtils, Warning, TEXT("A build is already running. Restart skipped."));
+            EditorPackageUtilsBuild::ShowCompletionNotification(TEXT("A build is already running."), false);
+        }
+        else
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to start UnrealBuildTool. Restart skipped."));
+            EditorPackageUtilsBuild::ShowCompletionNotification(TEXT("Failed to start UnrealBuildTool. See the output log for details."), false);
+        }
+    }
+}
+
+/**
+ * 에디터를 종료하고, 프로젝트를 다시 실행하는 함수.
+ * 현재 에디터를 종료한 후, 해당 프로젝트 파일을 다시 실행합니다.
  *
- * @param FilePath 실제 파일 시스템 경로. 예: "C:/Unreal Projects/YourProject/Content/MyAsset/MyFile"
- * @return Unreal Engine 패키지 경로. 예: "/Game/MyAsset/MyFile" 또는 "/PluginName/Content/MyAsset/MyFile"
+ * @param ProjectPath 다시 실행할 프로젝트의 파일 경로.
  */
-FString EditorPackageUtils::ConvertFilePathToPackagePath(const FString& FilePath)
+void EditorPackageUtils::RestartEditorWithProject(const FString& ProjectPath)
 {
-    // -- 프로젝트의 콘텐츠 디렉터리 경로를 절대 경로로 변환
-    FString ProjectContentDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectContentDir());
-    UE_LOG(LogTemp, Log, TEXT("Absolute Project Content Dir: %s"), *ProjectContentDir);
-
-    // -- 프로젝트 콘텐츠 폴더 내에 있는지 확인
-    if (FilePath.StartsWith(ProjectContentDir))
-    {
-        // 콘텐츠 폴더 내에 있을 경우 경로 변환
-        FString RelativePath = FilePath.RightChop(ProjectContentDir.Len());
-
-        // -- 슬래시 중복 방지
-        RelativePath.RemoveFromStart(TEXT("/"));
+    check(IsInGameThread());
 
-        // -- Unreal 경로로 변환
-        FString PackagePath = FString::Printf(TEXT("/Game/%s"), *RelativePath);
-        UE_LOG(LogTemp, Log, TEXT("Converted Package Path: %s"), *PackagePath);
-        return PackagePath;
-    }
-
-    // -- 플러그인의 콘텐츠 디렉터리에서 확인
-    const TArray<TSharedRef<IPlugin>> Plugins = IPluginManager::Get().GetEnabledPlugins();
-    for (const TSharedRef<IPlugin>& Plugin : Plugins)
-    {
-        FString PluginContentDir = FPaths::ConvertRelativePathToFull(Plugin->GetContentDir());
-        if (FilePath.StartsWith(PluginContentDir))
-        {
-            // 플러그인의 콘텐츠 폴더 내에 있을 경우 경로 변환
-            FString RelativePath = FilePath.RightChop(PluginContentDir.Len());
+    // 현재 실행 중인 에디터의 경로
+    FString EditorPath = FPlatformProcess::ExecutablePath();
 
-            // -- 슬래시 중복 방지
-            RelativePath.RemoveFromStart(TEXT("/"));
+    // 인자로 현재 프로젝트의 경로를 전달
+    FString Arguments = FString::Printf(TEXT("\"%s\""), *ProjectPath);
 
-            // 플러그인 경로로 변환
-            FString PackagePath = FString::Printf(TEXT("/%s/%s"), *Plugin->GetName(), *RelativePath);
-            UE_LOG(LogTemp, Log, TEXT("Converted Plugin Package Path: %s"), *PackagePath);
-            return PackagePath;
-        }
-    }
+    // 에디터 재시작 (현재 프로젝트로)
+    FPlatformProcess::CreateProc(*EditorPath, *Arguments, true, false, false, nullptr, 0, nullptr, nullptr);
 
-    // 경로가 인식되지 않으면 에러 로그 출력 및 빈 문자열 반환
-    UE_LOG(LogTemp, Error, TEXT("FilePath is not inside any recognized content or plugin directory: %s"), *FilePath);
-    return FString();
+    // 에디터 종료 (에디터 종료 후 새로운 프로세스가 실행됨)
+    FPlatformMisc::RequestExit(false);
 }
 
 /**
- /**
- * 플러그인의 언리얼 패키지 경로 (예: "/Game/Plugins/PluginName/...")를 실제 파일 시스템 경로로 변환하는 함수.
- * 패키지 경로가 플러그인 콘텐츠 폴더에 있는 경우, 프로젝트의 플러그인 디렉터리를 기준으로 풀 경로를 계산합니다.
- * 그 외에는 기본적으로 FPackageName::LongPackageNameToFilename 함수를 사용하여 프로젝트 콘텐츠 디렉터리를 기준으로 경로를 변환합니다.
+ * 여러 에셋의 패키지를 한 번에 찾거나 만드는 함수.
+ * 항목을 디렉터리별로 묶어 디렉터리마다 경로 변환과 디렉터리 생성을 한 번씩만 수행합니다.
+ * 결과를 NewAssetInPackage에 넘기면 에셋을 처음부터 최종 패키지와 이름으로 만들 수 있으므로,
+ * 트랜지언트 패키지에서 만든 뒤 Rename으로 옮기는 비용(리디렉터, 트랜잭션 기록, 이름 해시 갱신)이 들지 않습니다.
  *
- * @param FullPackagePath 언리얼 패키지 경로 (예: "/Game/Plugins/PluginName/...").
- * @return Unreal 패키지 경로에 해당하는 실제 파일 시스템 경로 (예: "C:/Unreal Projects/YourProject/Plugins/PluginName/Content/.../Asset.uasset").
+ * @param Items 만들 패키지 목록.
+ * @param OutResults Items와 같은 순서의 결과. 실패한 항목은 Package가 nullptr.
+ * @return 패키지를 찾거나 만든 항목 수.
  */
-FString EditorPackageUtils::PluginLongPackageNameToFilename(const FString& FullPackagePath)
+int32 EditorPackageUtils::CreateAssetPackages(TArrayView<const FEditorPackageCreateItem> Items, TArray<FEditorPackageCreateResult>& OutResults)
 {
-    // "Plugins/"를 기준으로 앞의 모든 경로를 제거
-    int32 PluginsIndex = FullPackagePath.Find(TEXT("Plugins/"));
-    if (PluginsIndex != INDEX_NONE)
-    {
-        // "Plugins/" 이후의 경로를 추출
-        FString PluginRelativePath = FullPackagePath.RightChop(PluginsIndex + 8); // "Plugins/" 제거
+    EDITORPACKAGEUTILS_SCOPED_STAT(CreateAssetPackages);
+    check(IsInGameThread());
 
-        // 플러그인의 이름을 추출 ("/PluginName/..."의 형태에서 첫 번째 부분 추출)
-        int32 SlashIndex;
-        if (PluginRelativePath.FindChar(TEXT('/'), SlashIndex))
-        {
-            FString PluginName = PluginRelativePath.Left(SlashIndex);
+    OutResults.Reset();
+    OutResults.SetNum(Items.Num());
 
-            // PluginName과 Content를 합친 경로 생성
-            FString PluginContentDir = FPaths::Combine(FPaths::ProjectPluginsDir(), PluginName, TEXT("Content"));
+    // -- 디렉터리별로 항목 분류
+    TMap<FString, TArray<int32>> ItemsByDirectory;
+    for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+    {
+        ItemsByDirectory.FindOrAdd(Items[ItemIndex].SaveDirectory).Add(ItemIndex);
+    }
 
-            // PluginRelativePath에서 PluginName 제거하고 남은 경로 얻기
-            FString RemainingPath = PluginRelativePath.RightChop(SlashIndex + 1);
+    int32 NumCreated = 0;
+    for (const TPair<FString, TArray<int32>>& DirectoryItems : ItemsByDirectory)
+    {
+        const FString& SaveDirectory = DirectoryItems.Key;
 
-            // 최종 경로 생성 (Plugins/PluginName/Content/RemainingPath)
-            return FPaths::Combine(PluginContentDir, RemainingPath + TEXT(".uasset"));
+        // -- SaveDirectory 에서 PackagePath 로 경로 변환 (디렉터리당 한 번)
+        FString PackageDirectory = ConvertFilePathToPackagePath(SaveDirectory);
+        if (PackageDirectory.IsEmpty())
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("SaveDirectory is not inside any recognized content directory: %s"), *SaveDirectory);
+            continue;
         }
-        else
+        PackageDirectory.RemoveFromEnd(TEXT("/"));
+
+        // -- 디렉터리 생성 (디렉터리당 한 번)
+        EditorPackageUtilsPrivate::EnsureDirectoryExists(SaveDirectory);
+
+        for (int32 ItemIndex : DirectoryItems.Value)
         {
-            // 플러그인 이름 뒤에 경로가 없을 경우 에러 처리
-            UE_LOG(LogTemp, Error, TEXT("Invalid plugin path: %s"), *FullPackagePath);
-            return FString();
+            const FEditorPackageCreateItem& Item = Items[ItemIndex];
+            FEditorPackageCreateResult& Result = OutResults[ItemIndex];
+
+            if (Item.FileName.IsEmpty())
+            {
+                UE_LOG(LogEditorPackageUtils, Error, TEXT("FileName is empty! (item %d)"), ItemIndex);
+                continue;
+            }
+
+            Result.Package = EditorPackageUtilsPrivate::FindOrCreatePackage(FPaths::Combine(PackageDirectory, Item.FileName));
+            if (!Result.Package)
+            {
+                continue;
+            }
+
+            Result.AssetName = FName(*Item.FileName);
+            Result.Filename = EnsureUAssetExtension(FPaths::Combine(SaveDirectory, Item.FileName));
+            ++NumCreated;
         }
     }
-    else
-    {
-        // 플러그인 폴더에 속하지 않으면 기본적인 Unreal 방식으로 경로를 변환
-        return FPackageName::LongPackageNameToFilename(FullPackagePath, FPackageName::GetAssetPackageExtension());
-    }
+
+    return NumCreated;
 }
 
 /**
- * 주어진 에셋 경로를 기준으로 에셋이 이미 Asset Registry에 등록되어 있는지 확인하는 함수.
+ * CreateAssetPackages로 만든 패키지 안에 최종 이름의 에셋 오브젝트를 만드는 함수.
+ * 같은 이름의 오브젝트가 이미 있고 클래스가 같으면 그 자리에서 다시 생성하고,
+ * 클래스가 다르면 기존 오브젝트를 트랜지언트 패키지로 옮긴 뒤 GC 대상으로 돌립니다.
+ * 만든 에셋은 SaveAssetToPackage, SaveAssetsToPackages 등으로 저장할 때 이동 없이 그대로 저장됩니다.
  *
- * @param AssetPath 확인할 에셋의 경로 (예: "/Game/MyFolder/MyAsset").
- * @return 에셋이 이미 등록되어 있으면 true, 그렇지 않으면 false를 반환.
+ * @param Created CreateAssetPackages 결과 항목.
+ * @param Class 만들 에셋의 클래스.
+ * @param Flags 에셋 오브젝트 플래그.
+ * @return 만든 에셋. Created.Package가 없거나 Class가 없으면 nullptr.
  */
-bool EditorPackageUtils::IsAssetAlreadyRegistered(const FString& AssetPath)
+UObject* EditorPackageUtils::NewAssetInPackage(const FEditorPackageCreateResult& Created, UClass* Class, EObjectFlags Flags)
 {
-    // AssetRegistry 모듈을 가져옴
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
+    check(IsInGameThread());
+
+    if (!Created.Package || !Class)
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Cannot create asset %s without a package and class"), *Created.AssetName.ToString());
+        return nullptr;
+    }
 
-    // AssetRegistry를 통해 에셋 정보를 가져옴
-    FSoftObjectPath SoftAssetPath(AssetPath);
-    FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(SoftAssetPath);
+    // -- 다른 클래스의 같은 이름 오브젝트는 자리를 비워 줌
+    if (UObject* ExistingObject = StaticFindObjectFast(nullptr, Created.Package, Created.AssetName))
+    {
+        if (ExistingObject->GetClass() != Class)
+        {
+            UE_LOG(LogEditorPackageUtils, Warning, TEXT("Replacing %s of class %s with a new %s"),
+                *ExistingObject->GetPathName(), *ExistingObject->GetClass()->GetName(), *Class->GetName());
+            ExistingObject->ClearFlags(RF_Standalone | RF_Public);
+            ExistingObject->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional | REN_DoNotDirty);
+        }
+    }
 
-    // 에셋 데이터가 유효하면 이미 등록된 에셋임
-    return AssetData.IsValid();
+    return NewObject<UObject>(Created.Package, Class, Created.AssetName, Flags);
 }
 
 /**
- * 동적으로 모듈명과 구조체명을 기반으로 구조체 정의(타입 정보)를 로드합니다.
- * 이 함수는 구조체의 인스턴스가 아닌, 해당 구조체의 정의를 로드합니다.
+ * SaveObject를 주어진 디렉터리와 파일 이름에 맞게 Unreal Engine 패키지로 저장하는 함수.
+ * SaveObject가 이미 존재하는 패키지에 속하지 않으면 새로운 패키지를 생성하고,
+ * 이후 이 패키지를 저장합니다. 패키지 경로는 Unreal Engine에서 사용되는
+ * "/Game" 또는 "/PluginName" 형식의 패키지 경로로 변환됩니다.
+ * CreateAssetPackages와 NewAssetInPackage로 만든 오브젝트는 이미 최종 위치에 있으므로 Rename 없이 저장합니다.
  *
- * @param ModuleName 로드할 구조체가 속한 모듈의 이름.
- * @param StructName 로드할 구조체의 이름.
- * @return UScriptStruct* 구조체의 정의가 성공적으로 로드되면 해당 구조체의 포인터를 반환, 실패하면 nullptr을 반환.
+ * @param SaveObject 저장할 UObject.
+ * @param SaveDirectory 파일 시스템 상의 저장할 디렉터리 경로 (예: "C:/Unreal Projects/YourProject/Content/...").
+ * @param FileName 저장할 파일 이름 (확장자는 필요하지 않음).
  */
-UScriptStruct* EditorPackageUtils::LoadStructDefinitionByName(const FString& ModuleName, const FString& StructName)
+UPackage* EditorPackageUtils::SaveAssetToPackage(UObject* const SaveObject, const FString& SaveDirectory, const FString& FileName, EObjectFlags TopLevelFlags)
 {
-    // RowStructPath 설정 (구조체 정의를 동적으로 찾기 위한 경로)
-    FString RowStructPath = FString::Printf(TEXT("/Script/%s.%s"), *ModuleName, *StructName);
+    EDITORPACKAGEUTILS_SCOPED_STAT(SaveAssetToPackage);
+    check(IsInGameThread());
 
-    // UScriptStruct 정의 로드
-    UScriptStruct* RowStruct = LoadObject<UScriptStruct>(nullptr, *RowStructPath);
+    FEditorPackageSaveTiming Timing;
+    FEditorPackageSaveTiming* const OutTiming = FEditorPackageSaveProfiler::IsEnabled() ? &Timing : nullptr;
+
+    FString FilePath;
+    UPackage* ExistingPackage = EditorPackageUtilsPrivate::PrepareAssetForSave(SaveObject, SaveDirectory, FileName, FilePath, true, OutTiming);
+    if (!ExistingPackage)
+    {
+        return nullptr;
+    }
 
-    if (!RowStruct)
+    // -- 패키지 저장 처리
+    const FSavePackageResultStruct SaveResult = EditorPackageUtilsPrivate::SavePackage(ExistingPackage, SaveObject, FilePath, SAVE_None, OutTiming);
+    if (!SaveResult.IsSuccessful())
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to load struct definition: %s from module: %s"), *StructName, *ModuleName);
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to save package: %s"), *FilePath);
+        return nullptr;
     }
     else
     {
-        UE_LOG(LogTemp, Log, TEXT("Successfully loaded struct definition: %s from module: %s"), *StructName, *ModuleName);
+        UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Successfully saved package: %s"), *FilePath);
+        FEditorPackageUtilsStats::Get().RecordBytesSaved(SaveResult.TotalFileSize);
+    }
+
+    if (OutTiming)
+    {
+        FEditorPackageSaveProfiler::Get().RecordPackage(ExistingPackage, SaveObject, Timing, SaveResult.TotalFileSize);
     }
 
-    return RowStruct;
+    return ExistingPackage;
 }
 
 /**
- * 동적으로 모듈명과 클래스명을 기반으로 클래스 정의(타입 정보)를 로드합니다.
- * 이 함수는 클래스 인스턴스가 아닌, 해당 클래스의 정의를 로드합니다.
+ * 내용이 바뀐 경우에만 SaveObject를 패키지로 저장하는 함수.
+ * 내용 해시가 FEditorPackageFingerprintStore에 기록된 마지막 저장 때와 같고 디스크의 파일도 그대로라면
+ * 파일 기록과 더티 표시를 모두 건너뛰므로 소스 컨트롤 변경과 불필요한 재쿡이 생기지 않습니다.
+ * 건너뛴 비율은 FEditorPackageUtilsStats에 집계되며 EditorPackageUtils.DumpStats로 확인할 수 있습니다.
  *
- * @param ModuleName 로드할 클래스가 속한 모듈의 이름.
- * @param ClassName 로드할 클래스의 이름.
- * @return UClass* 클래스 정의가 성공적으로 로드되면 해당 클래스의 포인터를 반환, 실패하면 nullptr을 반환.
+ * @param SaveObject 저장할 UObject.
+ * @param SaveDirectory 파일 시스템 상의 저장할 디렉터리 경로 (예: "C:/Unreal Projects/YourProject/Content/...").
+ * @param FileName 저장할 파일 이름 (확장자는 필요하지 않음).
+ * @param ContentHash 호출자가 계산한 내용 해시. 0이면 오브젝트의 직렬화된 프로퍼티로 계산합니다.
+ * @return 저장 결과. 기록을 건너뛰면 bSuccess와 bSkipped가 모두 true.
  */
-UClass* EditorPackageUtils::LoadClassDefinitionByName(const FString& ModuleName, const FString& ClassName)
+FEditorPackageSaveResult EditorPackageUtils::SaveAssetToPackageIfChanged(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName, uint64 ContentHash)
 {
-    // ClassPath 설정 (클래스 정의를 동적으로 찾기 위한 경로)
-    FString ClassPath = FString::Printf(TEXT("/Script/%s.%s"), *ModuleName, *ClassName);
+    EDITORPACKAGEUTILS_SCOPED_STAT(SaveAssetToPackageIfChanged);
+    check(IsInGameThread());
 
-    // UClass 정의 로드
-    UClass* LoadedClass = LoadObject<UClass>(nullptr, *ClassPath);
+    FEditorPackageSaveTiming Timing;
+    FEditorPackageSaveTiming* const OutTiming = FEditorPackageSaveProfiler::IsEnabled() ? &Timing : nullptr;
 
-    if (!LoadedClass)
+    FEditorPackageSaveResult Result;
+    Result.Package = EditorPackageUtilsPrivate::PrepareAssetForSave(SaveObject, SaveDirectory, FileName, Result.Filename, false, OutTiming);
+    if (!Result.Package)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to load class definition: %s from module: %s"), *ClassName, *ModuleName);
+        return Result;
     }
-    else
+
+    // -- 마지막 저장과 내용이 같으면 기록하지 않음
+    FEditorPackageFingerprintStore& FingerprintStore = FEditorPackageFingerprintStore::Get();
+    if (ContentHash == 0)
     {
-        UE_LOG(LogTemp, Log, TEXT("Successfully loaded class definition: %s from module: %s"), *ClassName, *ModuleName);
+        ContentHash = FEditorPackageFingerprintStore::ComputeContentHash(SaveObject);
     }
 
-    return LoadedClass;
-}
+    const bool bUnchanged = FingerprintStore.IsUnchanged(Result.Package->GetFName(), Result.Filename, ContentHash);
+    FEditorPackageUtilsStats::Get().RecordFingerprintCheck(bUnchanged);
+    if (bUnchanged)
+    {
+        UE_LOG(LogEditorPackageUtils, Verbose, TEXT("Package is unchanged, skipped: %s"), *Result.Filename);
+        Result.bSuccess = true;
+        Result.bSkipped = true;
+        return Result;
+    }
 
-/**
- * 빌드를 실행하고 핫 리로드를 처리하는 함수.
- * 빌드 중에는 상태를 알리기 위한 노티피케이션을 표시하며, 빌드 완료 후 핫 리로드를 실행합니다.
- */
-void EditorPackageUtils::ExecuteBuildAndHotReload()
-{
-    // 빌드 진행 상태를 알리기 위한 노티피케이션 생성
-    FNotificationInfo Info(FText::FromString(TEXT("Build in progress...")));
-    Info.bFireAndForget = false;  // 자동으로 사라지지 않도록 설정
-    Info.FadeOutDuration = 0.5f;
-    Info.ExpireDuration = 0.0f;
-    Info.bUseThrobber = true;  // 계속 도는 아이콘 사용
-    Info.bUseSuccessFailIcons = true;
+    SaveObject->MarkPackageDirty();
 
-    TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
-    if (NotificationItem.IsValid())
+    const FSavePackageResultStruct SaveResult = EditorPackageUtilsPrivate::SavePackage(Result.Package, SaveObject, Result.Filename, SAVE_None, OutTiming);
+    if (!SaveResult.IsSuccessful())
     {
-        NotificationItem->SetCompletionState(SNotificationItem::CS_Pending);  // 진행 중 상태로 설정
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to save package: %s"), *Result.Filename);
+        FingerprintStore.Remove(Result.Package->GetFName());
+        return Result;
     }
 
-    // 빌드 실행
-    GUnrealEd->Exec(NULL, TEXT("Build"));
+    Result.bSuccess = true;
+    Result.FileSize = SaveResult.TotalFileSize;
+    FEditorPackageUtilsStats::Get().RecordBytesSaved(Result.FileSize);
+    FingerprintStore.Record(Result.Package->GetFName(), ContentHash, IFileManager::Get().FileSize(*Result.Filename));
 
-    // 빌드 완료 후 상태 업데이트
-    if (NotificationItem.IsValid())
+    if (OutTiming)
     {
-        NotificationItem->SetText(FText::FromString(TEXT("Build completed successfully!")));
-        NotificationItem->SetCompletionState(SNotificationItem::CS_Success);  // 성공 상태로 설정
-        NotificationItem->ExpireAndFadeout();  // 완료 후 알림을 서서히 사라지게 함
+        FEditorPackageSaveProfiler::Get().RecordPackage(Result.Package, SaveObject, Timing, Result.FileSize);
     }
 
-    // 핫 리로드 트리거
-    IHotReloadInterface& HotReload = FModuleManager::LoadModuleChecked<IHotReloadInterface>("HotReload");
-    HotReload.DoHotReloadFromEditor(EHotReloadFlags::None);
+    return Result;
 }
 
 /**
- * 비동기적으로 빌드를 실행하고, 빌드 완료 후 에디터를 다시 시작하는 함수.
- * 빌드 진행 중에는 노티피케이션을 통해 상태를 표시하고, 빌드가 성공적으로 완료되면 에디터를 다시 시작합니다.
- * 실패 시에는 실패 메시지를 표시합니다.
+ * 여러 UObject를 한 번에 Unreal Engine 패키지로 저장하는 함수.
+ * 저장 항목을 디렉터리별로 묶어 디렉터리마다 경로 변환과 디렉터리 생성을 한 번씩만 수행하고,
+ * 전체 항목의 등록 여부는 Asset Registry 호출 한 번으로 확인합니다.
+ * 새로 추가된 에셋은 모든 저장이 끝난 뒤 한 번에 Asset Registry에 알립니다.
+ * 맵이 아닌 패키지는 UPackage::SaveConcurrent를 통해 병렬로 저장하며, 맵 패키지는 순차적으로 저장합니다.
+ * OnlyIfChanged 모드에서는 내용이 마지막 저장 때와 같은 항목을 저장 목록에서 제외합니다 (SaveAssetToPackageIfChanged 참고).
+ * 여러 항목이 같은 패키지(같은 디렉터리와 FileName)를 가리키면 처음 항목만 저장하고 나머지는 실패로 처리합니다.
  *
- * @note 빌드 프로세스는 비동기적으로 실행되며, 완료되면 에디터를 재시작합니다.
+ * @param Items 저장할 항목 목록.
+ * @param SaveMode 저장 방식.
+ * @return Items와 같은 순서의 항목별 저장 결과.
  */
-void EditorPackageUtils::StartBuildAndRestartEditor()
+TArray<FEditorPackageSaveResult> EditorPackageUtils::SaveAssetsToPackages(TArrayView<const FEditorPackageSaveItem> Items, EEditorPackageSaveMode SaveMode)
 {
-    // 빌드 진행 상태를 알리기 위한 노티피케이션 생성
-    FNotificationInfo Info(FText::FromString(TEXT("Build in progress...")));
-    Info.bFireAndForget = false;  // 자동으로 사라지지 않도록 설정
-    Info.FadeOutDuration = 0.5f;
-    Info.ExpireDuration = 0.0f;
-    Info.bUseThrobber = true;  // 계속 도는 아이콘 사용
-    Info.bUseSuccessFailIcons = true;
+    EDITORPACKAGEUTILS_SCOPED_STAT(SaveAssetsToPackages);
+    check(IsInGameThread());
+
+    TArray<FEditorPackageSaveResult> Results;
+    Results.SetNum(Items.Num());
+
+    // -- 디렉터리별로 저장 항목 분류
+    TMap<FString, TArray<int32>> ItemsByDirectory;
+    for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+    {
+        if (!Items[ItemIndex].Object)
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("SaveObject is null! (item %d)"), ItemIndex);
+            continue;
+        }
+        ItemsByDirectory.FindOrAdd(Items[ItemIndex].SaveDirectory).Add(ItemIndex);
+    }
+
+    const bool bOnlyIfChanged = SaveMode == EEditorPackageSaveMode::OnlyIfChanged;
+    FEditorPackageFingerprintStore& FingerprintStore = FEditorPackageFingerprintStore::Get();
 
-    TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
-    if (NotificationItem.IsValid())
+    // -- 프로파일링 중이면 항목별 단계 시간. 디렉터리와 배치 단위로 잰 시간은 항목에 나눠 더함
+    const bool bProfile = FEditorPackageSaveProfiler::IsEnabled();
+    TArray<FEditorPackageSaveTiming> ItemTimings;
+    if (bProfile)
     {
-        NotificationItem->SetCompletionState(SNotificationItem::CS_Pending);  // 빌드 진행 중 상태로 설정
+        ItemTimings.SetNum(Items.Num());
     }
+    auto GetItemTiming = [&ItemTimings](int32 ItemIndex) { return ItemTimings.IsEmpty() ? nullptr : &ItemTimings[ItemIndex]; };
+
+    TArray<FPackageSaveInfo> SaveInfos;
+    TArray<int32> SaveInfoItems;
+    TArray<uint64> SaveInfoHashes;
+    int32 NumSkipped = 0;
+
+    // -- 같은 패키지를 두 번 병렬 저장하지 않도록 패키지 경로별로 처음 나온 항목만 저장
+    TMap<FString, int32> ItemsByPackagePath;
 
-    // 비동기 작업으로 빌드 프로세스를 실행
-    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [=]()
+    for (const TPair<FString, TArray<int32>>& DirectoryItems : ItemsByDirectory)
+    {
+        const FString& SaveDirectory = DirectoryItems.Key;
+
+        // -- SaveDirectory 에서 PackagePath 로 경로 변환 (디렉터리당 한 번)
+        const uint64 ConvertStartCycles = bProfile ? FPlatformTime::Cycles64() : 0;
+        FString PackageDirectory = EditorPackageUtils::ConvertFilePathToPackagePath(SaveDirectory);
+        if (PackageDirectory.IsEmpty())
         {
-            // UnrealBuildTool.exe 절대 경로 설정 (동적으로 엔진 설치 경로 가져오기)
-            FString UBTPath = FPaths::Combine(
-                FPaths::EngineDir(),  // 현재 엔진 설치 경로를 자동으로 가져옴
-                TEXT("Binaries"),
-                TEXT("DotNET"),
-                TEXT("UnrealBuildTool"),
-                TEXT("UnrealBuildTool.exe")  // 정확한 파일 경로 (혹시 OS 나 엔진 버전에 따라 다르면 추가 처리 필요)
-            );
-            UE_LOG(LogTemp, Log, TEXT("UBTPath: %s"), *UBTPath);  // 디버깅 로그 출력
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("SaveDirectory is not inside any recognized content directory: %s"), *SaveDirectory);
+            continue;
+        }
+        PackageDirectory.RemoveFromEnd(TEXT("/"));
 
-            // 실제로 해당 경로에 파일이 있는지 확인
-            if (!FPaths::FileExists(UBTPath))
+        if (bProfile)
+        {
+            const uint64 ConvertCycles = (FPlatformTime::Cycles64() - ConvertStartCycles) / DirectoryItems.Value.Num();
+            for (int32 ItemIndex : DirectoryItems.Value)
             {
-                UE_LOG(LogTemp, Error, TEXT("UnrealBuildTool.exe file does not exist at: %s"), *UBTPath);
-                return;
+                ItemTimings[ItemIndex].Add(EEditorPackageSavePhase::PathConversion, ConvertCycles);
             }
+        }
 
-            // 프로젝트 경로
-            FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
-            UE_LOG(LogTemp, Log, TEXT("ProjectPath: %s"), *ProjectPath);  // 디버깅 로그 출력
-
-            // 빌드 명령어 인자 구성 (프로젝트 경로 포함)
-            FString Arguments = FString::Printf(TEXT("\"%s\" -projectfiles"), *ProjectPath);
-            UE_LOG(LogTemp, Log, TEXT("Arguments: %s"), *Arguments);  // 디버깅 로그 출력
+        // -- 디렉터리 생성 (디렉터리당 한 번)
+        EditorPackageUtilsPrivate::EnsureDirectoryExists(SaveDirectory);
 
-            // 빌드 프로세스 실행
-            FProcHandle BuildProcess = FPlatformProcess::CreateProc(*UBTPath, *Arguments, true, false, false, nullptr, 0, nullptr, nullptr);
+        for (int32 ItemIndex : DirectoryItems.Value)
+        {
+            const FEditorPackageSaveItem& Item = Items[ItemIndex];
+            FEditorPackageSaveResult& Result = Results[ItemIndex];
 
-            if (!BuildProcess.IsValid())
+            const FString FullPackagePath = FPaths::Combine(PackageDirectory, Item.FileName);
+            if (const int32* FirstItemIndex = ItemsByPackagePath.Find(FullPackagePath))
             {
-                UE_LOG(LogTemp, Error, TEXT("Failed to start build process."));
-                AsyncTask(ENamedThreads::GameThread, [NotificationItem]()
-                    {
-                        if (NotificationItem.IsValid())
-                        {
-                            NotificationItem->SetText(FText::FromString(TEXT("Build failed to start!")));
-                            NotificationItem->SetCompletionState(SNotificationItem::CS_Fail);
-                            NotificationItem->ExpireAndFadeout();
-                        }
-                    });
-                return;
+                UE_LOG(LogEditorPackageUtils, Error, TEXT("Item %d resolves to the same package as item %d and was not saved: %s"), ItemIndex, *FirstItemIndex, *FullPackagePath);
+                continue;
             }
+            ItemsByPackagePath.Add(FullPackagePath, ItemIndex);
 
-            // 빌드 결과를 대기 및 감시
-            while (FPlatformProcess::IsProcRunning(BuildProcess))
+            UPackage* Package = nullptr;
             {
-                FPlatformProcess::Sleep(1);  // 빌드 중일 때 대기
+                FEditorPackageSavePhaseScope PhaseScope(GetItemTiming(ItemIndex), EEditorPackageSavePhase::Rename);
+                Package = EditorPackageUtilsPrivate::FindOrCreatePackageForAsset(Item.Object, FullPackagePath, Item.FileName);
+            }
+            if (!Package)
+            {
+                continue;
             }
 
-            int32 ReturnCode;
-            FPlatformProcess::GetProcReturnCode(BuildProcess, &ReturnCode);
-
-            // 메인 스레드에서 후속 작업 실행
-            AsyncTask(ENamedThreads::GameThread, [=]()
-                {
-                    if (ReturnCode == 0)
-                    {
-                        // 빌드 성공
-                        UE_LOG(LogTemp, Log, TEXT("Build completed successfully!"));
-
-                        if (NotificationItem.IsValid())
-                        {
-                            NotificationItem->SetText(FText::FromString(TEXT("Build completed successfully!")));
-                            NotificationItem->SetCompletionState(SNotificationItem::CS_Success);  // 성공 상태로 업데이트
-                            NotificationItem->ExpireAndFadeout();
-                        }
-
-                        // 에디터 재시작
-                        RestartEditorWithProject(ProjectPath);  // 현재 프로젝트로 재시작
-                    }
-                    else
-                    {
-                        // 빌드 실패
-                        UE_LOG(LogTemp, Error, TEXT("Build failed. Check the logs for more details."));
-
-                        if (NotificationItem.IsValid())
-                        {
-                            NotificationItem->SetText(FText::FromString(TEXT("Build failed!")));
-                            NotificationItem->SetCompletionState(SNotificationItem::CS_Fail);  // 실패 상태로 업데이트
-                            NotificationItem->ExpireAndFadeout();
-                        }
-                    }
-                });
-        });
-}
+            Result.Package = Package;
+            Result.Filename = EditorPackageUtils::EnsureUAssetExtension(FPaths::Combine(SaveDirectory, Item.FileName));
 
-/**
- * 에디터를 종료하고, 프로젝트를 다시 실행하는 함수.
- * 현재 에디터를 종료한 후, 해당 프로젝트 파일을 다시 실행합니다.
- *
- * @param ProjectPath 다시 실행할 프로젝트의 파일 경로.
- */
-void EditorPackageUtils::RestartEditorWithProject(const FString& ProjectPath)
-{
-    // 현재 실행 중인 에디터의 경로
-    FString EditorPath = FPlatformProcess::ExecutablePath();
+            // -- 마지막 저장과 내용이 같으면 저장 목록에서 제외
+            uint64 ContentHash = 0;
+            if (bOnlyIfChanged)
+            {
+                ContentHash = Item.ContentHash != 0 ? Item.ContentHash : FEditorPackageFingerprintStore::ComputeContentHash(Item.Object);
 
-    // 인자로 현재 프로젝트의 경로를 전달
-    FString Arguments = FString::Printf(TEXT("\"%s\""), *ProjectPath);
+                const bool bUnchanged = FingerprintStore.IsUnchanged(Package->GetFName(), Result.Filename, ContentHash);
+                FEditorPackageUtilsStats::Get().RecordFingerprintCheck(bUnchanged);
+                if (bUnchanged)
+                {
+                    Result.bSuccess = true;
+                    Result.bSkipped = true;
+                    ++NumSkipped;
+                    continue;
+                }
+            }
 
-    // 에디터 재시작 (현재 프로젝트로)
-    FPlatformProcess::CreateProc(*EditorPath, *Arguments, true, false, false, nullptr, 0, nullptr, nullptr);
+            Item.Object->MarkPackageDirty();
 
-    // 에디터 종료 (에디터 종료 후 새로운 프로세스가 실행됨)
-    FPlatformMisc::RequestExit(false);
-}
+            FPackageSaveInfo& SaveInfo = SaveInfos.AddDefaulted_GetRef();
+            SaveInfo.Package = Package;
+            SaveInfo.Asset = Item.Object;
+            SaveInfo.Filename = Result.Filename;
+            SaveInfoItems.Add(ItemIndex);
+            SaveInfoHashes.Add(ContentHash);
+        }
+    }
 
-/**
- * SaveObject를 주어진 디렉터리와 파일 이름에 맞게 Unreal Engine 패키지로 저장하는 함수.
- * SaveObject가 이미 존재하는 패키지에 속하지 않으면 새로운 패키지를 생성하고,
- * 이후 이 패키지를 저장합니다. 패키지 경로는 Unreal Engine에서 사용되는
- * "/Game" 또는 "/PluginName" 형식의 패키지 경로로 변환됩니다.
- *
- * @param SaveObject 저장할 UObject.
- * @param SaveDirectory 파일 시스템 상의 저장할 디렉터리 경로 (예: "C:/Unreal Projects/YourProject/Content/...").
- * @param FileName 저장할 파일 이름 (확장자는 필요하지 않음).
- */
-UPackage* EditorPackageUtils::SaveAssetToPackage(UObject* const SaveObject, const FString& SaveDirectory, const FString& FileName, EObjectFlags TopLevelFlags)
-{
-    if (!SaveObject)
+    // -- 이미 등록된 에셋을 레지스트리 호출 한 번으로 조회
+    const uint64 RegistryStartCycles = bProfile ? FPlatformTime::Cycles64() : 0;
+    TArray<FSoftObjectPath> ObjectPaths;
+    ObjectPaths.Reserve(SaveInfos.Num());
+    for (const FPackageSaveInfo& SaveInfo : SaveInfos)
     {
-        UE_LOG(LogTemp, Error, TEXT("SaveObject is null!"));
-        return nullptr;
+        ObjectPaths.Emplace(SaveInfo.Asset);
     }
+    TBitArray<> RegisteredAssets;
+    EditorPackageUtils::AreAssetsRegistered(ObjectPaths, RegisteredAssets);
 
-    // -- 프로젝트의 콘텐츠 디렉터리 경로를 절대 경로로 변환
-    // SaveDirectory 에서 PackagePath 로 경로 변환
-    FString RelativePath = EditorPackageUtils::ConvertFilePathToPackagePath(SaveDirectory);
-    UE_LOG(LogTemp, Log, TEXT("Convert RelativePath: %s"), *RelativePath);
-    if (RelativePath.IsEmpty())
+    if (bProfile && SaveInfoItems.Num() > 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("SaveDirectory is not inside any recognized content directory: %s (%s)"), *SaveDirectory, *RelativePath);
-        return nullptr;
+        const uint64 RegistryCycles = (FPlatformTime::Cycles64() - RegistryStartCycles) / SaveInfoItems.Num();
+        for (int32 ItemIndex : SaveInfoItems)
+        {
+            ItemTimings[ItemIndex].Add(EEditorPackageSavePhase::Registry, RegistryCycles);
+        }
     }
 
-    // -- 패키지 경로에 SaveObject 이름을 추가하여 최종 패키지 경로를 생성
-    FString FullPackagePath = FPaths::Combine(RelativePath, FileName);
-    UE_LOG(LogTemp, Log, TEXT("Full Package Path: %s"), *FullPackagePath);
+    // -- 저장 (가능한 경우 병렬)
+    FEditorPackageSaveTiming BatchTiming;
+    TArray<FSavePackageResultStruct> SaveResults;
+    EditorPackageUtilsPrivate::SavePackages(SaveInfos, SAVE_None, SaveResults, bProfile ? &BatchTiming : nullptr);
 
-    // -- 패키지 생성
-    UPackage* ExistingPackage = FindPackage(nullptr, *FullPackagePath);
-    if (!ExistingPackage)
+    // -- 병렬 저장은 패키지별 시간을 알 수 없으므로 배치 시간을 파일 크기 비율로 나눔
+    if (bProfile && SaveInfoItems.Num() > 0)
     {
-        // -- 패키지 생성
-        ExistingPackage = CreatePackage(*FullPackagePath);
-        if (!ExistingPackage)
+        int64 TotalFileSize = 0;
+        for (const FSavePackageResultStruct& SaveResult : SaveResults)
         {
-            UE_LOG(LogTemp, Error, TEXT("Failed to create package: %s"), *FullPackagePath);
-            return nullptr;
+            TotalFileSize += SaveResult.TotalFileSize;
+        }
+
+        for (int32 SaveIndex = 0; SaveIndex < SaveInfoItems.Num(); ++SaveIndex)
+        {
+            const double Share = TotalFileSize > 0 ? (double)SaveResults[SaveIndex].TotalFileSize / TotalFileSize : 1.0 / SaveInfoItems.Num();
+            for (EEditorPackageSavePhase Phase : { EEditorPackageSavePhase::Serialization, EEditorPackageSavePhase::FileIO, EEditorPackageSavePhase::WriteDrain })
+            {
+                ItemTimings[SaveInfoItems[SaveIndex]].Add(Phase, (uint64)(BatchTiming.PhaseCycles[(int32)Phase] * Share));
+            }
         }
-        UE_LOG(LogTemp, Log, TEXT("Package created: %s"), *FullPackagePath);
     }
-    SaveObject->Rename(*FileName, ExistingPackage);
 
-    // -- Asset 등록
-    if (EditorPackageUtils::IsAssetAlreadyRegistered(FullPackagePath) == false)
+    for (int32 SaveIndex = 0; SaveIndex < SaveInfoItems.Num(); ++SaveIndex)
     {
-        FAssetRegistryModule::AssetCreated(SaveObject);
-    }
+        FEditorPackageSaveResult& Result = Results[SaveInfoItems[SaveIndex]];
+        if (SaveResults[SaveIndex].IsSuccessful())
+        {
+            Result.bSuccess = true;
+            Result.FileSize = SaveResults[SaveIndex].TotalFileSize;
+            FEditorPackageUtilsStats::Get().RecordBytesSaved(Result.FileSize);
 
-    // -- 패키지 저장
-    SaveObject->MarkPackageDirty();
+            if (bOnlyIfChanged)
+            {
+                FingerprintStore.Record(Result.Package->GetFName(), SaveInfoHashes[SaveIndex], IFileManager::Get().FileSize(*Result.Filename));
+            }
+        }
+        else if (bOnlyIfChanged)
+        {
+            FingerprintStore.Remove(Result.Package->GetFName());
+        }
+    }
 
-    if (!IFileManager::Get().DirectoryExists(*SaveDirectory))
+    // -- 새로 추가된 에셋을 한 번에 Asset Registry에 알림
+    for (int32 SaveIndex = 0; SaveIndex < SaveInfoItems.Num(); ++SaveIndex)
     {
-        IFileManager::Get().MakeDirectory(*SaveDirectory, true);
-        UE_LOG(LogTemp, Log, TEXT("Created directory: %s"), *SaveDirectory);
+        const int32 ItemIndex = SaveInfoItems[SaveIndex];
+        if (!RegisteredAssets[SaveIndex] && Results[ItemIndex].bSuccess)
+        {
+            FEditorPackageSavePhaseScope PhaseScope(GetItemTiming(ItemIndex), EEditorPackageSavePhase::Registry);
+            FAssetRegistryModule::AssetCreated(Items[ItemIndex].Object);
+        }
     }
 
-    FString FilePath = FPaths::Combine(SaveDirectory, FileName);
-    FilePath = EditorPackageUtils::EnsureUAssetExtension(FilePath);
+    if (bProfile)
+    {
+        FEditorPackageSaveProfiler& Profiler = FEditorPackageSaveProfiler::Get();
+        for (int32 ItemIndex : SaveInfoItems)
+        {
+            const FEditorPackageSaveResult& Result = Results[ItemIndex];
+            if (Result.bSuccess)
+            {
+                Profiler.RecordPackage(Result.Package, Items[ItemIndex].Object, ItemTimings[ItemIndex], Result.FileSize);
+            }
+        }
+    }
 
-    // -- 패키지 저장 처리
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = EObjectFlags::RF_Public | EObjectFlags::RF_Standalone;
-    SaveArgs.Error = GError;
-    SaveArgs.SaveFlags = SAVE_None;
-    SaveArgs.bForceByteSwapping = false;
-    SaveArgs.bWarnOfLongFilename = true;
-    bool bSaved = UPackage::SavePackage(ExistingPackage, SaveObject, *FilePath, SaveArgs);
-    if (!bSaved)
+    int32 NumSaved = 0;
+    for (const FEditorPackageSaveResult& Result : Results)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to save package: %s"), *FilePath);
-        return nullptr;
+        if (Result.bSuccess)
+        {
+            ++NumSaved;
+        }
+        else if (Result.Package)
+        {
+            UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to save package: %s"), *Result.Filename);
+        }
+    }
+    if (bOnlyIfChanged)
+    {
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Saved %d/%d packages in %d directories (%d unchanged, %.1f%% skipped)"),
+            NumSaved - NumSkipped, Items.Num(), ItemsByDirectory.Num(), NumSkipped, Items.Num() > 0 ? 100.0 * NumSkipped / Items.Num() : 0.0);
+        FingerprintStore.Flush();
     }
     else
     {
-        UE_LOG(LogTemp, Log, TEXT("Successfully saved package: %s"), *FilePath);
+        UE_LOG(LogEditorPackageUtils, Log, TEXT("Saved %d/%d packages in %d directories"), NumSaved, Items.Num(), ItemsByDirectory.Num());
     }
 
-    return ExistingPackage;
+    return Results;
+}
+
+/**
+ * SaveObject를 비동기로 Unreal Engine 패키지로 저장하는 함수.
+ * 패키지 생성, 이동, 에셋 등록 등 UObject 작업은 호출 즉시 게임 스레드에서 처리하고,
+ * 직렬화와 파일 기록은 FEditorPackageAsyncSaveQueue가 이후 틱에서 배치로 묶어 워커 스레드에서 처리합니다.
+ *
+ * @param SaveObject 저장할 UObject. 저장이 완료될 때까지 호출자가 유지해야 하며, 그동안 수정하면 안 됩니다.
+ * @param SaveDirectory 파일 시스템 상의 저장할 디렉터리 경로 (예: "C:/Unreal Projects/YourProject/Content/...").
+ * @param FileName 저장할 파일 이름 (확장자는 필요하지 않음).
+ * @return 파일 기록이 끝나면 게임 스레드에서 완료되는 저장 결과.
+ */
+TFuture<FEditorPackageSaveResult> EditorPackageUtils::SaveAssetToPackageAsync(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName)
+{
+    EDITORPACKAGEUTILS_SCOPED_STAT(SaveAssetToPackageAsync);
+    check(IsInGameThread());
+
+    return FEditorPackageAsyncSaveQueue::Get().Enqueue(SaveObject, SaveDirectory, FileName);
+}
+
+/**
+ * 여러 UObject를 에디터 틱마다 나눠 저장하는 함수.
+ * 항목을 FEditorPackageTimeSlicedRunner에 제출해 틱마다 프레임 예산 안에서 처리할 수 있는 만큼씩 SaveAssetsToPackages로 저장하므로,
+ * 대량 저장 중에도 에디터가 멈추지 않습니다. 진행 상황은 노티피케이션에 표시되며 일시정지하거나 취소할 수 있습니다.
+ * 저장이 끝날 때까지 항목의 오브젝트는 GC되지 않도록 유지합니다.
+ *
+ * @param Items 저장할 항목 목록.
+ * @param SaveMode 저장 방식.
+ * @param OutJob nullptr이 아니면 일시정지, 취소에 사용할 작업 핸들을 받습니다.
+ * @return 작업이 끝나면 게임 스레드에서 완료되는 Items와 같은 순서의 저장 결과. 취소되어 처리하지 않은 항목은 bSuccess가 false입니다.
+ */
+TFuture<TArray<FEditorPackageSaveResult>> EditorPackageUtils::SaveAssetsToPackagesTimeSliced(TArrayView<const FEditorPackageSaveItem> Items, EEditorPackageSaveMode SaveMode, TSharedPtr<FEditorPackageBatchJob>* OutJob)
+{
+    check(IsInGameThread());
+
+    struct FTimeSlicedSave
+    {
+        TArray<FEditorPackageSaveItem> Items;
+        TArray<TStrongObjectPtr<UObject>> KeepAlive;
+        TArray<FEditorPackageSaveResult> Results;
+        TPromise<TArray<FEditorPackageSaveResult>> Promise;
+    };
+
+    TSharedRef<FTimeSlicedSave> Save = MakeShared<FTimeSlicedSave>();
+    Save->Items = Items;
+    Save->Results.SetNum(Items.Num());
+    Save->KeepAlive.Reserve(Items.Num());
+    for (const FEditorPackageSaveItem& Item : Items)
+    {
+        Save->KeepAlive.Emplace(Item.Object);
+    }
+    TFuture<TArray<FEditorPackageSaveResult>> Future = Save->Promise.GetFuture();
+
+    TSharedRef<FEditorPackageBatchJob> Job = FEditorPackageTimeSlicedRunner::Get().Submit(
+        FText::Format(NSLOCTEXT("EditorPackageUtils", "SavingPackages", "Saving {0} packages"), FText::AsNumber(Items.Num())),
+        Items.Num(),
+        FOnEditorPackageBatchJobSlice::CreateLambda([Save, SaveMode](int32 StartIndex, int32 Count)
+            {
+                TArray<FEditorPackageSaveResult> SliceResults = SaveAssetsToPackages(MakeArrayView(Save->Items).Slice(StartIndex, Count), SaveMode);
+                for (int32 Index = 0; Index < SliceResults.Num(); ++Index)
+                {
+                    Save->Results[StartIndex + Index] = MoveTemp(SliceResults[Index]);
+                }
+            }),
+        FOnEditorPackageBatchJobFinished::CreateLambda([Save](const FEditorPackageBatchJobResult& Result)
+            {
+                Save->KeepAlive.Empty();
+                Save->Promise.SetValue(MoveTemp(Save->Results));
+            }));
+
+    if (OutJob)
+    {
+        *OutJob = Job;
+    }
+    return Future;
+}
+
+/**
+ * SaveAssetToPackageAsync로 요청한 저장이 모두 디스크에 기록될 때까지 기다리는 함수.
+ * 커맨드렛처럼 에디터 틱이 돌지 않는 환경에서는 종료 전에 반드시 호출해야 합니다.
+ */
+void EditorPackageUtils::FlushAsyncSaves()
+{
+    check(IsInGameThread());
+
+    FEditorPackageAsyncSaveQueue::Get().Flush();
 }
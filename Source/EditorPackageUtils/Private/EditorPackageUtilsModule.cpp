@@ -1,18 +1,45 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "EditorPackageUtilsModule.h"
+#include "EditorPackageMountTable.h"
+#include "EditorPackageAsyncSaveQueue.h"
+#include "EditorPackageBuildRunner.h"
+#include "EditorPackageFingerprintStore.h"
+#include "EditorPackageGameThreadDispatcher.h"
+#include "EditorPackageMetadataCache.h"
+#include "EditorPackageTimeSlicedRunner.h"
+#include "EditorPackageTypeCache.h"
+#include "EditorPackageUtilsLog.h"
 
 #define LOCTEXT_NAMESPACE "EditorPackageUtilsModule"
 
+DEFINE_LOG_CATEGORY(LogEditorPackageUtils);
+
 void FEditorPackageUtilsModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	FEditorPackageMetadataCache::Get().Initialize();
+	FEditorPackageMountTable::Get().Initialize();
+	FEditorPackageAsyncSaveQueue::Get().Initialize();
+	FEditorPackageTypeCache::Get().Initialize();
+	FEditorPackageFingerprintStore::Get().Initialize();
+	FEditorPackageBuildRunner::Get().Initialize();
+	FEditorPackageGameThreadDispatcher::Get().Initialize();
+	FEditorPackageTimeSlicedRunner::Get().Initialize();
 }
 
 void FEditorPackageUtilsModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FEditorPackageTimeSlicedRunner::Get().Shutdown();
+	FEditorPackageBuildRunner::Get().Shutdown();
+	FEditorPackageGameThreadDispatcher::Get().Shutdown();
+	FEditorPackageMetadataCache::Get().Shutdown();
+	FEditorPackageFingerprintStore::Get().Shutdown();
+	FEditorPackageTypeCache::Get().Shutdown();
+	FEditorPackageAsyncSaveQueue::Get().Shutdown();
+	FEditorPackageMountTable::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
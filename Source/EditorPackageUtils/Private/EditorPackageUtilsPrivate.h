@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SavePackage.h"
+#include "UObject/Package.h"
+
+class IAssetRegistry;
+struct FEditorPackageSaveTiming;
+
+/**
+ * EditorPackageUtils 모듈 내부에서 공유하는 저장 관련 헬퍼 함수들.
+ */
+namespace EditorPackageUtilsPrivate
+{
+    /**
+     * FullPackagePath 패키지를 찾고, 없으면 생성합니다.
+     *
+     * @return 패키지. 생성에 실패하면 nullptr.
+     */
+    UPackage* FindOrCreatePackage(const FString& FullPackagePath);
+
+    /**
+     * FullPackagePath 패키지를 찾거나 생성한 뒤 SaveObject를 해당 패키지로 옮깁니다.
+     * NewAssetInPackage로 만든 오브젝트처럼 이미 최종 위치에 있으면 이동하지 않고,
+     * 트랜지언트 패키지에서 만든 오브젝트는 리디렉터와 트랜잭션 기록 없이 옮깁니다.
+     * 이동만으로는 패키지를 더티로 표시하지 않습니다.
+     *
+     * @return SaveObject가 속하게 된 패키지. 패키지 생성에 실패하면 nullptr.
+     */
+    UPackage* FindOrCreatePackageForAsset(UObject* SaveObject, const FString& FullPackagePath, const FString& FileName);
+
+    /**
+     * 실제 저장 전에 게임 스레드에서 필요한 UObject 작업을 수행합니다.
+     * 패키지 생성 및 이동(Rename), Asset Registry 등록, 패키지 더티 표시, 저장 디렉터리 생성을 처리합니다.
+     *
+     * @param OutFilePath 패키지를 저장할 파일 경로 (.uasset 포함).
+     * @param bMarkDirty false면 패키지를 더티로 표시하지 않습니다. 변경 여부를 확인한 뒤 호출자가 직접 표시합니다.
+     * @param OutTiming nullptr이 아니면 경로 변환, Rename, Asset Registry 단계의 소요 시간을 더합니다.
+     * @return SaveObject가 속하게 된 패키지. 실패하면 nullptr.
+     */
+    UPackage* PrepareAssetForSave(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName, FString& OutFilePath, bool bMarkDirty = true, FEditorPackageSaveTiming* OutTiming = nullptr);
+
+    /** SaveAssetToPackage 계열 함수들이 공통으로 사용하는 저장 인자. */
+    FSavePackageArgs MakeSaveArgs(uint32 SaveFlags = SAVE_None);
+
+    /**
+     * 패키지들을 저장합니다. 맵이 아닌 패키지가 여러 개면 UPackage::SaveConcurrent로 병렬 저장하고,
+     * 맵 패키지와 단일 패키지는 UPackage::Save로 순차 저장합니다.
+     *
+     * @param SaveInfos 저장할 패키지, 에셋, 파일 경로.
+     * @param SaveFlags 저장 플래그 (예: SAVE_Async).
+     * @param OutResults SaveInfos와 같은 순서의 저장 결과.
+     * @param OutBatchTiming nullptr이 아니면 SAVE_Async로 저장한 뒤 파일 기록을 기다려, 배치 전체의 직렬화와 파일 기록 시간을 나눠 더합니다.
+     *        저장 전에 남아 있던 다른 호출자의 기록은 먼저 기다려 WriteDrain에 더합니다.
+     */
+    void SavePackages(TArrayView<const FPackageSaveInfo> SaveInfos, uint32 SaveFlags, TArray<FSavePackageResultStruct>& OutResults, FEditorPackageSaveTiming* OutBatchTiming = nullptr);
+
+    /**
+     * 패키지 하나를 UPackage::Save로 저장합니다.
+     * OutTiming이 nullptr이 아니면 SAVE_Async로 저장한 뒤 파일 기록을 기다려 직렬화와 파일 기록 시간을 나눠 더합니다.
+     * 저장 전에 남아 있던 다른 호출자의 기록은 먼저 기다려 WriteDrain에 더하므로, FileIO에는 이 패키지의 기록만 들어갑니다.
+     */
+    FSavePackageResultStruct SavePackage(UPackage* Package, UObject* Asset, const FString& Filename, uint32 SaveFlags = SAVE_None, FEditorPackageSaveTiming* OutTiming = nullptr);
+
+    /** 캐시된 Asset Registry. 모듈 매니저 조회는 처음 한 번만 수행합니다. */
+    IAssetRegistry& GetAssetRegistry();
+
+    /** 디렉터리가 없으면 생성합니다. 현재 FEditorPackageSaveSession이 있으면 세션의 디렉터리 캐시를 사용합니다. */
+    void EnsureDirectoryExists(const FString& Directory);
+
+    /**
+     * 더티 상태인 콘텐츠와 맵 패키지를 FEditorFileUtils::SaveDirtyPackages로 저장합니다. 저장 확인 대화상자는 표시하지 않습니다.
+     * 에디터 저장 경로를 거치므로 소스 컨트롤 체크아웃과 읽기 전용 파일 확인, 맵 저장 훅이 그대로 적용됩니다.
+     * 저장 후에도 더티로 남은 패키지(체크아웃 거절, /Temp 패키지 등)는 실패로 처리합니다.
+     *
+     * @return 모든 패키지를 저장했으면 true. 저장할 패키지가 없어도 true.
+     */
+    bool SaveDirtyPackages();
+}
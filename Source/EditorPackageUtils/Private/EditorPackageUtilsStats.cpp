@@ -0,0 +1,212 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageUtilsStats.h"
+#include "EditorPackageUtilsLog.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(EditorPackageUtilsChannel);
+
+TRACE_DECLARE_INT_COUNTER(EditorPackageUtilsBytesSaved, TEXT("EditorPackageUtils/BytesSaved"));
+
+namespace EditorPackageUtilsStats
+{
+    static FAutoConsoleCommand DumpStatsCommand(
+        TEXT("EditorPackageUtils.DumpStats"),
+        TEXT("EditorPackageUtils 함수별 통계를 로그에 출력하고 CSV로 저장합니다. 인자: [Filename]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+            {
+                const FEditorPackageUtilsStats& Stats = FEditorPackageUtilsStats::Get();
+                const FString Filename = Args.Num() > 0 ? Args[0] : FPaths::Combine(FPaths::ProfilingDir(), TEXT("EditorPackageUtilsStats.csv"));
+
+                UE_LOG(LogEditorPackageUtils, Display, TEXT("%-32s %10s %12s %10s %10s"), TEXT("Function"), TEXT("Calls"), TEXT("TotalMs"), TEXT("P50Ms"), TEXT("P99Ms"));
+                for (int32 StatIndex = 0; StatIndex < (int32)EEditorPackageUtilsStat::Num; ++StatIndex)
+                {
+                    const EEditorPackageUtilsStat Stat = (EEditorPackageUtilsStat)StatIndex;
+                    const FEditorPackageUtilsStats::FSummary Summary = Stats.GetSummary(Stat);
+                    if (Summary.Calls > 0)
+                    {
+                        UE_LOG(LogEditorPackageUtils, Display, TEXT("%-32s %10llu %12.3f %10.4f %10.4f"), FEditorPackageUtilsStats::GetStatName(Stat), Summary.Calls, Summary.TotalMs, Summary.P50Ms, Summary.P99Ms);
+                    }
+                }
+                UE_LOG(LogEditorPackageUtils, Display, TEXT("Bytes saved: %lld"), Stats.GetBytesSaved());
+                if (Stats.GetPackagesChecked() > 0)
+                {
+                    UE_LOG(LogEditorPackageUtils, Display, TEXT("Unchanged packages skipped: %lld/%lld (%.1f%%)"), Stats.GetPackagesSkipped(), Stats.GetPackagesChecked(), Stats.GetSkipRatio() * 100.0);
+                }
+
+                if (Stats.WriteCsv(Filename))
+                {
+                    UE_LOG(LogEditorPackageUtils, Display, TEXT("Wrote stats to %s"), *Filename);
+                }
+            }));
+
+    static FAutoConsoleCommand ResetStatsCommand(
+        TEXT("EditorPackageUtils.ResetStats"),
+        TEXT("EditorPackageUtils 함수별 통계를 초기화합니다."),
+        FConsoleCommandDelegate::CreateLambda([]()
+            {
+                FEditorPackageUtilsStats::Get().Reset();
+            }));
+}
+
+FEditorPackageUtilsStats& FEditorPackageUtilsStats::Get()
+{
+    static FEditorPackageUtilsStats Instance;
+    return Instance;
+}
+
+const TCHAR* FEditorPackageUtilsStats::GetStatName(EEditorPackageUtilsStat Stat)
+{
+    static const TCHAR* const Names[] =
+    {
+#define EDITORPACKAGEUTILS_STAT_NAME(Name) TEXT(#Name),
+        EDITORPACKAGEUTILS_STAT_LIST(EDITORPACKAGEUTILS_STAT_NAME)
+#undef EDITORPACKAGEUTILS_STAT_NAME
+    };
+    static_assert(UE_ARRAY_COUNT(Names) == (int32)EEditorPackageUtilsStat::Num, "Stat name table is out of sync");
+
+    return Names[(int32)Stat];
+}
+
+void FEditorPackageUtilsStats::RecordCall(EEditorPackageUtilsStat Stat, uint64 Cycles)
+{
+    FCounter& Counter = Counters[(int32)Stat];
+    Counter.Calls.fetch_add(1, std::memory_order_relaxed);
+    Counter.TotalCycles.fetch_add(Cycles, std::memory_order_relaxed);
+    Counter.Buckets[GetBucketIndex(Cycles)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void FEditorPackageUtilsStats::RecordBytesSaved(int64 Bytes)
+{
+    BytesSaved.fetch_add(Bytes, std::memory_order_relaxed);
+    TRACE_COUNTER_ADD(EditorPackageUtilsBytesSaved, Bytes);
+}
+
+void FEditorPackageUtilsStats::RecordFingerprintCheck(bool bSkipped)
+{
+    PackagesChecked.fetch_add(1, std::memory_order_relaxed);
+    if (bSkipped)
+    {
+        PackagesSkipped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+double FEditorPackageUtilsStats::GetSkipRatio() const
+{
+    const int64 Checked = GetPackagesChecked();
+    return Checked > 0 ? (double)GetPackagesSkipped() / Checked : 0.0;
+}
+
+FEditorPackageUtilsStats::FSummary FEditorPackageUtilsStats::GetSummary(EEditorPackageUtilsStat Stat) const
+{
+    const FCounter& Counter = Counters[(int32)Stat];
+
+    FSummary Summary;
+    Summary.Calls = Counter.Calls.load(std::memory_order_relaxed);
+    Summary.TotalMs = FPlatformTime::ToMilliseconds64(Counter.TotalCycles.load(std::memory_order_relaxed));
+    Summary.P50Ms = GetPercentileMs(Counter, Summary.Calls, 0.50);
+    Summary.P99Ms = GetPercentileMs(Counter, Summary.Calls, 0.99);
+    return Summary;
+}
+
+void FEditorPackageUtilsStats::Reset()
+{
+    for (FCounter& Counter : Counters)
+    {
+        Counter.Calls.store(0, std::memory_order_relaxed);
+        Counter.TotalCycles.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint64>& Bucket : Counter.Buckets)
+        {
+            Bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+    BytesSaved.store(0, std::memory_order_relaxed);
+    PackagesChecked.store(0, std::memory_order_relaxed);
+    PackagesSkipped.store(0, std::memory_order_relaxed);
+}
+
+FString FEditorPackageUtilsStats::ToCsv() const
+{
+    TStringBuilder<4096> Csv;
+    Csv << TEXT("Function,Calls,TotalMs,AvgMs,P50Ms,P99Ms\n");
+
+    for (int32 StatIndex = 0; StatIndex < (int32)EEditorPackageUtilsStat::Num; ++StatIndex)
+    {
+        const EEditorPackageUtilsStat Stat = (EEditorPackageUtilsStat)StatIndex;
+        const FSummary Summary = GetSummary(Stat);
+        const double AvgMs = Summary.Calls > 0 ? Summary.TotalMs / Summary.Calls : 0.0;
+
+        Csv.Appendf(TEXT("%s,%llu,%.4f,%.6f,%.6f,%.6f\n"), GetStatName(Stat), Summary.Calls, Summary.TotalMs, AvgMs, Summary.P50Ms, Summary.P99Ms);
+    }
+    Csv.Appendf(TEXT("BytesSaved,%lld,,,,\n"), GetBytesSaved());
+    Csv.Appendf(TEXT("PackagesChecked,%lld,,,,\n"), GetPackagesChecked());
+    Csv.Appendf(TEXT("PackagesSkipped,%lld,,,,\n"), GetPackagesSkipped());
+
+    return FString(Csv.ToView());
+}
+
+bool FEditorPackageUtilsStats::WriteCsv(const FString& Filename) const
+{
+    if (!FFileHelper::SaveStringToFile(ToCsv(), *Filename))
+    {
+        UE_LOG(LogEditorPackageUtils, Error, TEXT("Failed to write stats CSV: %s"), *Filename);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * 사이클 값을 로그 히스토그램 구간 인덱스로 변환하는 함수.
+ * 가장 높은 비트 아래 SubBucketBits 비트로 옥타브를 나누므로 구간 폭은 값의 1/4 이하입니다.
+ */
+int32 FEditorPackageUtilsStats::GetBucketIndex(uint64 Cycles)
+{
+    constexpr uint64 NumSubBuckets = 1ull << SubBucketBits;
+    if (Cycles < NumSubBuckets)
+    {
+        return (int32)Cycles;
+    }
+
+    const int32 HighBit = (int32)FMath::FloorLog2_64(Cycles);
+    const int32 SubBucket = (int32)((Cycles >> (HighBit - SubBucketBits)) & (NumSubBuckets - 1));
+    return ((HighBit - SubBucketBits + 1) << SubBucketBits) + SubBucket;
+}
+
+uint64 FEditorPackageUtilsStats::GetBucketMidpoint(int32 BucketIndex)
+{
+    constexpr int32 NumSubBuckets = 1 << SubBucketBits;
+    if (BucketIndex < NumSubBuckets)
+    {
+        return (uint64)BucketIndex;
+    }
+
+    const int32 HighBit = (BucketIndex >> SubBucketBits) + SubBucketBits - 1;
+    const uint64 SubBucket = (uint64)(BucketIndex & (NumSubBuckets - 1));
+    const int32 Shift = HighBit - SubBucketBits;
+    const uint64 Lower = (NumSubBuckets + SubBucket) << Shift;
+    return Lower + ((1ull << Shift) >> 1);
+}
+
+double FEditorPackageUtilsStats::GetPercentileMs(const FCounter& Counter, uint64 Calls, double Percentile) const
+{
+    if (Calls == 0)
+    {
+        return 0.0;
+    }
+
+    const uint64 TargetCount = FMath::Max<uint64>(1, (uint64)FMath::CeilToDouble(Calls * Percentile));
+    uint64 Accumulated = 0;
+    for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+    {
+        Accumulated += Counter.Buckets[BucketIndex].load(std::memory_order_relaxed);
+        if (Accumulated >= TargetCount)
+        {
+            return FPlatformTime::ToMilliseconds64(GetBucketMidpoint(BucketIndex));
+        }
+    }
+    return FPlatformTime::ToMilliseconds64(GetBucketMidpoint(NumBuckets - 1));
+}
@@ -0,0 +1,222 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EditorPackageFingerprintStore.h"
+#include "EditorPackageMountTable.h"
+#include "EditorPackageTemporaryMount.h"
+#include "EditorPackageTimeSlicedRunner.h"
+#include "EditorPackageUtils.h"
+#include "Curves/CurveFloat.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace EditorPackageUtilsTests
+{
+    /** 테스트 파일을 두는 디렉터리. 프로젝트 Content 대신 Intermediate 아래를 사용합니다. */
+    static FString GetTestRoot()
+    {
+        return FPaths::Combine(FPaths::ConvertRelativePathToFull(FPaths::ProjectIntermediateDir()), TEXT("EditorPackageUtilsTests"));
+    }
+
+    /** 마운트 테이블에 합성 플러그인 루트를 등록하고, 범위를 벗어나면 제거합니다. */
+    struct FScopedMountRoot
+    {
+        FString RootName;
+        FString ContentDir;
+
+        FScopedMountRoot(const FString& InRootName, const FString& InContentDir)
+            : RootName(InRootName)
+            , ContentDir(InContentDir)
+        {
+            FEditorPackageMountTable::Get().AddMountRoot(RootName, ContentDir);
+        }
+
+        ~FScopedMountRoot()
+        {
+            FEditorPackageMountTable::Get().RemoveMountRoot(RootName);
+        }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEditorPackagePathRoundTripTest, "EditorPackageUtils.Paths.RoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEditorPackagePathRoundTripTest::RunTest(const FString& Parameters)
+{
+    using namespace EditorPackageUtilsTests;
+
+    // -- 중첩 폴더의 플러그인 레이아웃
+    const FScopedMountRoot MountRoot(TEXT("EPUTestPlugin"), FPaths::Combine(GetTestRoot(), TEXT("Plugins"), TEXT("Group"), TEXT("EPUTestPlugin"), TEXT("Content")));
+    const FString FilePath = FPaths::Combine(MountRoot.ContentDir, TEXT("Folder"), TEXT("Asset"));
+    const FString Filename = FilePath + TEXT(".uasset");
+
+    TestEqual(TEXT("File path converts to the plugin root"), EditorPackageUtils::ConvertFilePathToPackagePath(FilePath), FString(TEXT("/EPUTestPlugin/Folder/Asset")));
+    TestEqual(TEXT("Plugin package converts back to the file path"), EditorPackageUtils::PluginLongPackageNameToFilename(TEXT("/EPUTestPlugin/Folder/Asset")), Filename);
+    TestEqual(TEXT("Legacy /Game/Plugins package converts to the same file path"), EditorPackageUtils::PluginLongPackageNameToFilename(TEXT("/Game/Plugins/EPUTestPlugin/Folder/Asset")), Filename);
+
+    // -- 일괄 변환도 단일 변환과 같은 결과
+    TArray<FString> PackagePaths;
+    TestEqual(TEXT("Batch conversion converts every path"), EditorPackageUtils::ConvertFilePathsToPackagePaths(MakeArrayView(&FilePath, 1), PackagePaths), 1);
+    TArray<FString> FilePaths;
+    TestEqual(TEXT("Batch reverse conversion converts every path"), EditorPackageUtils::ConvertPackagePathsToFilePaths(PackagePaths, FilePaths), 1);
+    if (FilePaths.Num() == 1)
+    {
+        TestEqual(TEXT("Batch round trip returns the original file"), FilePaths[0], Filename);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEditorPackageMountSnapshotTest, "EditorPackageUtils.Paths.MountSnapshot", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEditorPackageMountSnapshotTest::RunTest(const FString& Parameters)
+{
+    using namespace EditorPackageUtilsTests;
+
+    FEditorPackageMountTable& MountTable = FEditorPackageMountTable::Get();
+    const FString PackageName = TEXT("/EPUTestSnapshot/Asset");
+
+    const FEditorPackageMountSnapshotRef Before = MountTable.GetSnapshot();
+    FEditorPackageMountSnapshotRef During = Before;
+    {
+        const FScopedMountRoot MountRoot(TEXT("EPUTestSnapshot"), FPaths::Combine(GetTestRoot(), TEXT("Snapshot"), TEXT("Content")));
+        During = MountTable.GetSnapshot();
+    }
+    const FEditorPackageMountSnapshotRef After = MountTable.GetSnapshot();
+
+    // -- 이미 받은 스냅샷은 이후의 마운트 변경에 영향받지 않음
+    TStringBuilder<512> Filename;
+    TestFalse(TEXT("Snapshot taken before mounting does not see the root"), Before->TryConvertPackageNameToFilename(PackageName, Filename));
+    Filename.Reset();
+    TestTrue(TEXT("Snapshot taken while mounted sees the root"), During->TryConvertPackageNameToFilename(PackageName, Filename));
+    Filename.Reset();
+    TestFalse(TEXT("Snapshot taken after unmounting does not see the root"), After->TryConvertPackageNameToFilename(PackageName, Filename));
+    TestTrue(TEXT("Mounting publishes a new snapshot"), &Before.Get() != &During.Get());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEditorPackageSaveIfChangedTest, "EditorPackageUtils.Save.OnlyIfChanged", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEditorPackageSaveIfChangedTest::RunTest(const FString& Parameters)
+{
+    using namespace EditorPackageUtilsTests;
+
+    const FEditorPackageTemporaryMount SaveMount(TEXT("EPUTestSave"), FPaths::Combine(GetTestRoot(), TEXT("SaveContent")));
+    const FString SaveDirectory = FPaths::Combine(SaveMount.GetContentDir(), TEXT("Curves"));
+    const FName PackageName(TEXT("/EPUTestSave/Curves/Curve"));
+
+    FEditorPackageFingerprintStore::Get().Remove(PackageName);
+
+    UCurveFloat* Curve = NewObject<UCurveFloat>(GetTransientPackage(), NAME_None, RF_Public | RF_Standalone);
+    Curve->FloatCurve.AddKey(0.0f, 1.0f);
+
+    const FEditorPackageSaveResult First = EditorPackageUtils::SaveAssetToPackageIfChanged(Curve, SaveDirectory, TEXT("Curve"));
+    TestTrue(TEXT("First save succeeds"), First.bSuccess);
+    TestFalse(TEXT("First save writes the package"), First.bSkipped);
+
+    const FEditorPackageSaveResult Unchanged = EditorPackageUtils::SaveAssetToPackageIfChanged(Curve, SaveDirectory, TEXT("Curve"));
+    TestTrue(TEXT("Unchanged save succeeds"), Unchanged.bSuccess);
+    TestTrue(TEXT("Unchanged save is skipped"), Unchanged.bSkipped);
+
+    Curve->FloatCurve.AddKey(1.0f, 2.0f);
+    const FEditorPackageSaveResult Changed = EditorPackageUtils::SaveAssetToPackageIfChanged(Curve, SaveDirectory, TEXT("Curve"));
+    TestTrue(TEXT("Changed save succeeds"), Changed.bSuccess);
+    TestFalse(TEXT("Changed save writes the package"), Changed.bSkipped);
+
+    FEditorPackageFingerprintStore::Get().Remove(PackageName);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEditorPackageTimeSlicedCompleteTest, "EditorPackageUtils.TimeSliced.Complete", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEditorPackageTimeSlicedCompleteTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumItems = 100;
+
+    TArray<int32> VisitCounts;
+    VisitCounts.SetNumZeroed(NumItems);
+    TOptional<FEditorPackageBatchJobResult> FinishedResult;
+
+    const TSharedRef<FEditorPackageBatchJob> Job = FEditorPackageTimeSlicedRunner::Get().Submit(FText::FromString(TEXT("Time-sliced completion test")), NumItems,
+        FOnEditorPackageBatchJobSlice::CreateLambda([&VisitCounts](int32 StartIndex, int32 Count)
+            {
+                for (int32 Index = StartIndex; Index < StartIndex + Count; ++Index)
+                {
+                    ++VisitCounts[Index];
+                }
+            }),
+        FOnEditorPackageBatchJobFinished::CreateLambda([&FinishedResult](const FEditorPackageBatchJobResult& Result)
+            {
+                FinishedResult = Result;
+            }));
+
+    FEditorPackageTimeSlicedRunner::Get().Flush();
+
+    TestTrue(TEXT("Job is finished after Flush"), Job->IsFinished());
+    if (TestTrue(TEXT("Completion callback was called"), FinishedResult.IsSet()))
+    {
+        TestEqual(TEXT("Every item was processed"), FinishedResult->NumProcessed, NumItems);
+        TestFalse(TEXT("Completed job is not reported as canceled"), FinishedResult->bCanceled);
+    }
+    TestEqual(TEXT("Every item was visited exactly once"), VisitCounts.FilterByPredicate([](int32 VisitCount) { return VisitCount == 1; }).Num(), NumItems);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEditorPackageTimeSlicedCancelTest, "EditorPackageUtils.TimeSliced.Cancel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEditorPackageTimeSlicedCancelTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumItems = 100;
+
+    // -- 첫 슬라이스에서 작업을 취소
+    TWeakPtr<FEditorPackageBatchJob> WeakJob;
+    int32 NumVisited = 0;
+    TOptional<FEditorPackageBatchJobResult> FinishedResult;
+
+    const TSharedRef<FEditorPackageBatchJob> Job = FEditorPackageTimeSlicedRunner::Get().Submit(FText::FromString(TEXT("Time-sliced cancel test")), NumItems,
+        FOnEditorPackageBatchJobSlice::CreateLambda([&WeakJob, &NumVisited](int32 StartIndex, int32 Count)
+            {
+                NumVisited += Count;
+                if (TSharedPtr<FEditorPackageBatchJob> Pinned = WeakJob.Pin())
+                {
+                    Pinned->Cancel();
+                }
+            }),
+        FOnEditorPackageBatchJobFinished::CreateLambda([&FinishedResult](const FEditorPackageBatchJobResult& Result)
+            {
+                FinishedResult = Result;
+            }));
+    WeakJob = Job;
+
+    FEditorPackageTimeSlicedRunner::Get().Flush();
+
+    TestTrue(TEXT("Canceled job is finished after Flush"), Job->IsFinished());
+    if (TestTrue(TEXT("Completion callback was called"), FinishedResult.IsSet()))
+    {
+        TestTrue(TEXT("Result is reported as canceled"), FinishedResult->bCanceled);
+        TestTrue(TEXT("Processing stopped before the last item"), FinishedResult->NumProcessed < NumItems);
+        TestEqual(TEXT("Result counts only the processed items"), FinishedResult->NumProcessed, NumVisited);
+    }
+
+    // -- 처리 전에 취소한 작업은 슬라이스 없이 끝남
+    bool bSliceCalled = false;
+    const TSharedRef<FEditorPackageBatchJob> CanceledJob = FEditorPackageTimeSlicedRunner::Get().Submit(FText::FromString(TEXT("Time-sliced cancel before start test")), NumItems,
+        FOnEditorPackageBatchJobSlice::CreateLambda([&bSliceCalled](int32 StartIndex, int32 Count)
+            {
+                bSliceCalled = true;
+            }));
+    CanceledJob->Cancel();
+
+    FEditorPackageTimeSlicedRunner::Get().Flush();
+
+    TestTrue(TEXT("Job canceled before start is finished after Flush"), CanceledJob->IsFinished());
+    TestFalse(TEXT("Job canceled before start processes no items"), bSliceCalled);
+
+    return true;
+}
+
+#endif
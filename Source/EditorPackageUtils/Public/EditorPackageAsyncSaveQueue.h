@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "EditorPackageUtilsTypes.h"
+#include "UObject/SavePackage.h"
+#include "UObject/StrongObjectPtr.h"
+
+/**
+ * 패키지 저장을 비동기로 처리하는 저장 큐.
+ *
+ * 게임 스레드에서는 요청 시점에 UObject 작업(패키지 이동, 더티 표시, 에셋 등록)만 수행하고,
+ * 에디터 틱마다 대기 중인 패키지를 최대 MaxSavesPerTick개씩 배치로 묶어 워커 스레드의 태스크에서
+ * UPackage::SaveConcurrent로 직렬화하고 파일까지 기록합니다. 게임 스레드는 배치를 넘기고 결과를 받아 TFuture를 완료할 뿐입니다.
+ * 배치는 한 번에 하나만 진행하며, 태스크가 끝나면 다음 틱에 결과를 완료하고 다음 배치를 시작합니다.
+ * 파일 기록도 태스크 안에서 끝나므로 다른 호출자의 비동기 파일 기록(SAVE_Async)을 기다리지 않습니다.
+ *
+ * 배치를 저장하는 동안 태스크가 GC를 막고 배치의 오브젝트를 GC에서 보호합니다.
+ * 맵 패키지는 워커 스레드에서 저장할 수 없으므로 배치를 시작할 때 게임 스레드에서 바로 저장합니다.
+ *
+ * 대기 중인 요청 수는 MaxPendingSaves로 제한되며, 한도를 넘으면 요청한 쪽에서 Flush로 대기열을 비웁니다.
+ *
+ * @note 게임 스레드에서만 사용해야 합니다. 큐에 넣은 오브젝트와 그 패키지는 TFuture가 완료될 때까지 수정하면 안 됩니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageAsyncSaveQueue
+{
+public:
+    static FEditorPackageAsyncSaveQueue& Get();
+
+    /** 에디터 틱에 저장 큐 처리를 등록합니다. */
+    void Initialize();
+
+    /** 남은 저장을 모두 완료하고 틱 등록을 해제합니다. */
+    void Shutdown();
+
+    /**
+     * SaveObject 저장을 큐에 추가합니다.
+     *
+     * @param SaveObject 저장할 UObject. 저장이 완료될 때까지 GC되지 않도록 호출자가 유지해야 합니다.
+     * @param SaveDirectory 파일 시스템 상의 저장할 디렉터리 경로.
+     * @param FileName 저장할 파일 이름 (확장자는 필요하지 않음).
+     * @return 게임 스레드에서 완료되는 저장 결과.
+     */
+    TFuture<FEditorPackageSaveResult> Enqueue(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName);
+
+    /** 진행 중인 배치와 대기 중인 저장을 모두 완료할 때까지 기다립니다. 커맨드렛에서 종료 전에 호출해야 합니다. */
+    void Flush();
+
+    /** 아직 완료되지 않은 저장 요청 수. */
+    int32 GetNumOutstanding() const { return PendingSaves.Num() + (SavingBatch ? SavingBatch->Saves.Num() : 0); }
+
+    /** 대기열에 쌓일 수 있는 최대 요청 수. */
+    int32 MaxPendingSaves = 256;
+
+    /** 배치 하나로 워커 스레드에 넘길 최대 패키지 수. */
+    int32 MaxSavesPerTick = 32;
+
+private:
+    struct FQueuedSave
+    {
+        TWeakObjectPtr<UObject> Object;
+        FEditorPackageSaveResult Result;
+        TPromise<FEditorPackageSaveResult> Promise;
+    };
+
+    /** 워커 스레드에서 저장 중인 요청들. */
+    struct FSaveBatch
+    {
+        TArray<TUniquePtr<FQueuedSave>> Saves;
+
+        /** 저장이 끝날 때까지 오브젝트를 GC에서 보호합니다. 게임 스레드에서 만들고 해제합니다. */
+        TArray<TStrongObjectPtr<UObject>> KeepAlive;
+
+        /** SaveResults의 각 결과에 해당하는 Saves의 인덱스. */
+        TArray<int32> SaveIndices;
+
+        TFuture<TArray<FSavePackageResultStruct>> SaveResults;
+    };
+
+    bool Tick(float DeltaTime);
+
+    /** 대기 중인 요청 중 최대 MaxSaves개를 배치로 묶어 워커 스레드에서 저장을 시작합니다. */
+    void StartBatch(int32 MaxSaves);
+
+    /** 진행 중인 배치가 끝날 때까지 기다린 뒤 요청들의 결과를 완료합니다. */
+    void CompleteBatch();
+
+    TArray<TUniquePtr<FQueuedSave>> PendingSaves;
+    TUniquePtr<FSaveBatch> SavingBatch;
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
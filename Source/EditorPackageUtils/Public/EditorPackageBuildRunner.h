@@ -0,0 +1,148 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class FMonitoredProcess;
+class SNotificationItem;
+
+/**
+ * UnrealBuildTool 실행 결과와 단계별 소요 시간.
+ */
+struct FEditorPackageBuildResult
+{
+    /** UnrealBuildTool 종료 코드. 실행하지 못했거나 취소되면 -1. */
+    int32 ReturnCode = -1;
+
+    bool bSuccess = false;
+    bool bCanceled = false;
+
+    /** 프로세스 생성에 걸린 시간(초). */
+    double LaunchSeconds = 0.0;
+
+    /** 프로세스 시작부터 종료까지 걸린 시간(초). */
+    double CompileSeconds = 0.0;
+
+    /** StartBuild 호출부터 완료 처리까지 걸린 전체 시간(초). */
+    double TotalSeconds = 0.0;
+};
+
+DECLARE_DELEGATE_OneParam(FOnEditorPackageBuildFinished, const FEditorPackageBuildResult& /*Result*/);
+
+/**
+ * UnrealBuildTool 실행을 담당하는 빌드 러너.
+ *
+ * FMonitoredProcess로 UBT를 실행하므로 작업 스레드를 점유하거나 Sleep으로 폴링하지 않으며,
+ * 프로세스 종료와 출력은 이벤트로 전달됩니다.
+ * UBT 표준 출력은 파이프로 읽어 LogEditorPackageUtils와 진행 노티피케이션에 실시간으로 표시하고,
+ * 노티피케이션의 취소 버튼이나 Cancel()로 빌드를 중단할 수 있습니다.
+ * 완료 콜백은 항상 게임 스레드에서 호출됩니다.
+ *
+ * @note 한 번에 하나의 빌드만 실행할 수 있습니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageBuildRunner
+{
+public:
+    static FEditorPackageBuildRunner& Get();
+
+    /** 이 세션이 로드한 바이너리의 지문을 기록합니다. 모듈 시작 시 호출됩니다. */
+    void Initialize();
+
+    /** 진행 중인 빌드를 취소합니다. 모듈 종료 시 호출됩니다. */
+    void Shutdown();
+
+    /**
+     * 현재 플랫폼에 맞는 UnrealBuildTool 실행 파일(또는 Build 스크립트) 경로를 찾습니다.
+     *
+     * @return 실행 파일 경로. 찾지 못하면 빈 문자열.
+     */
+    static FString FindUnrealBuildTool();
+
+    /**
+     * 현재 에디터 타깃을 컴파일하는 UBT 인자를 만듭니다.
+     * 예: "UnrealEditor Win64 Development -Project="C:/MyProject/MyProject.uproject" -WaitMutex -FromMsBuild"
+     */
+    static FString MakeEditorTargetArguments();
+
+    /**
+     * 이 에디터 세션에서 Live Coding이 켜져 있는지 확인합니다.
+     * 켜져 있으면 UBT가 실행 중인 에디터의 타깃 빌드를 거부하고, 핫 리로드도 사용할 수 없습니다.
+     */
+    static bool IsLiveCodingEnabled();
+
+    /**
+     * 프로젝트와 프로젝트 플러그인의 소스 지문을 계산합니다.
+     * Source 디렉터리의 모든 파일과 .uproject/.uplugin 설명자의 경로, 수정 시각, 크기를 해시합니다.
+     */
+    static uint64 ComputeSourceFingerprint();
+
+    /**
+     * 프로젝트와 프로젝트 플러그인의 바이너리 지문을 계산합니다.
+     * Binaries/<Platform> 디렉터리의 파일(모듈 바이너리와 *.modules 매니페스트)의 이름, 수정 시각, 크기를 해시합니다.
+     */
+    static uint64 ComputeBinaryFingerprint();
+
+    /** Initialize 시점에 계산한, 이 세션이 로드한 바이너리의 지문. */
+    uint64 GetSessionBinaryFingerprint() const { return SessionBinaryFingerprint; }
+
+    /**
+     * 마지막으로 성공한 빌드 이후 소스와 바이너리가 모두 그대로인지 확인합니다.
+     * true이면 UBT를 실행해도 바뀌는 것이 없습니다.
+     */
+    bool IsBuildUpToDate(uint64 SourceFingerprint, uint64 BinaryFingerprint) const;
+
+    /** 성공한 빌드의 소스 지문과 빌드 후 바이너리 지문을 기록합니다. */
+    void RecordSuccessfulBuild(uint64 SourceFingerprint, uint64 BinaryFingerprint);
+
+    /**
+     * UnrealBuildTool을 비동기로 실행합니다.
+     *
+     * @param Arguments UBT 명령줄 인자.
+     * @param StatusText 노티피케이션에 표시할 진행 문구.
+     * @param OnFinished 빌드가 끝나면 게임 스레드에서 호출되는 콜백.
+     * @return 빌드를 시작했으면 true. 이미 빌드 중이거나 UBT를 찾지 못했거나 실행하지 못하면 false.
+     *         false이면 OnFinished를 호출하지 않고 노티피케이션도 표시하지 않으므로, 호출자가 실패를 알려야 합니다.
+     */
+    bool StartBuild(const FString& Arguments, const FText& StatusText, FOnEditorPackageBuildFinished OnFinished);
+
+    /** 진행 중인 빌드를 취소합니다. 완료 콜백은 bCanceled = true로 호출됩니다. */
+    void Cancel();
+
+    bool IsRunning() const { return Process.IsValid(); }
+
+private:
+    void HandleOutput(FString Output);
+    void HandleCompleted(int32 ReturnCode);
+    void HandleCanceled();
+
+    /** 게임 스레드에서 빌드 결과를 정리하고 콜백을 호출합니다. */
+    void Finish(int32 ReturnCode, bool bCanceled);
+
+    TSharedPtr<FMonitoredProcess> Process;
+    TSharedPtr<SNotificationItem> NotificationItem;
+    FOnEditorPackageBuildFinished OnBuildFinished;
+
+    /** 마지막으로 성공한 빌드 기록을 읽습니다. 없으면 false. */
+    bool LoadLastBuild();
+
+    static FString GetLastBuildFilename();
+
+    uint64 SessionBinaryFingerprint = 0;
+
+    /** 마지막으로 성공한 빌드의 소스/바이너리 지문. 기록이 없으면 0. */
+    uint64 LastBuildSourceFingerprint = 0;
+    uint64 LastBuildBinaryFingerprint = 0;
+
+    double StartTime = 0.0;
+    double LaunchedTime = 0.0;
+    double ExitedTime = 0.0;
+
+    /** 모니터 스레드가 마지막으로 받은 출력 줄. */
+    FString LatestOutput;
+    FCriticalSection LatestOutputLock;
+
+    /** 노티피케이션 갱신 요청이 이미 게임 스레드에 예약되어 있는지 여부. */
+    std::atomic<bool> bNotificationUpdatePending{ false };
+};
@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UObject;
+
+/**
+ * 마지막으로 저장한 패키지 내용의 지문(해시)을 보관하는 저장소.
+ *
+ * "변경된 경우에만 저장" 모드에서 사용하며, 저장할 내용의 해시가 마지막 저장 때와 같고
+ * 디스크의 파일 크기도 그대로라면 파일 기록과 더티 표시를 모두 건너뜁니다.
+ * 지문은 Intermediate/EditorPackageUtils/PackageFingerprints.bin에 저장되어 에디터를 다시 시작해도 유지됩니다.
+ *
+ * @note 게임 스레드에서만 사용해야 합니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageFingerprintStore
+{
+public:
+    static FEditorPackageFingerprintStore& Get();
+
+    /** 디스크에서 지문을 읽어옵니다. */
+    void Initialize();
+
+    /** 변경된 지문을 디스크에 기록합니다. */
+    void Shutdown();
+
+    /**
+     * SaveObject와 그 하위 오브젝트의 직렬화된 프로퍼티로 내용 해시를 계산합니다.
+     * 오브젝트 참조는 경로 이름으로 해시하므로 세션이 바뀌어도 같은 내용이면 같은 값이 나옵니다.
+     *
+     * @note 네이티브 Serialize로만 기록되는 데이터(벌크 데이터 등)는 포함되지 않습니다. 이런 에셋은 호출자가 해시를 직접 전달해야 합니다.
+     * @return 0이 아닌 64비트 해시.
+     */
+    static uint64 ComputeContentHash(UObject* SaveObject);
+
+    /**
+     * 마지막으로 저장한 내용과 같은지 확인합니다.
+     *
+     * @param PackageName 패키지 이름 (예: "/Game/MyFolder/MyAsset").
+     * @param Filename 패키지 파일 경로. 파일이 없거나 크기가 다르면 변경된 것으로 봅니다.
+     * @param ContentHash 저장할 내용의 해시.
+     * @return 지문이 같고 파일이 그대로 있으면 true.
+     */
+    bool IsUnchanged(FName PackageName, const FString& Filename, uint64 ContentHash) const;
+
+    /** 저장이 끝난 패키지의 지문을 기록합니다. */
+    void Record(FName PackageName, uint64 ContentHash, int64 FileSize);
+
+    /** 패키지의 지문을 제거합니다. */
+    void Remove(FName PackageName);
+
+    /** 모든 지문을 제거합니다. */
+    void Clear();
+
+    /** 변경된 지문이 있으면 디스크에 기록합니다. */
+    bool Flush();
+
+    int32 Num() const { return Fingerprints.Num(); }
+
+    /** 지문 파일 경로. */
+    static FString GetStoreFilename();
+
+private:
+    struct FFingerprint
+    {
+        uint64 ContentHash = 0;
+        int64 FileSize = 0;
+    };
+
+    bool Load();
+
+    TMap<FName, FFingerprint> Fingerprints;
+    bool bDirty = false;
+};
@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/SoftObjectPath.h"
+
+/**
+ * 워커 스레드의 게임 스레드 전용 요청을 모아 한 번의 게임 스레드 틱에서 처리하는 디스패처.
+ *
+ * EditorPackageUtils의 Asset Registry 조회, 타입 조회, 패키지 생성/저장처럼 게임 스레드에서만 호출할 수 있는 함수를
+ * 워커 스레드에서 사용할 때 씁니다. 요청은 잠금으로 보호되는 대기열에 쌓였다가 다음 코어 틱에서 한꺼번에 실행되고,
+ * 결과는 TFuture로 돌려줍니다. 같은 틱에 모인 Asset Registry 조회는 AreAssetsRegistered 한 번으로 처리합니다.
+ *
+ * 게임 스레드에서 호출하면 대기열을 거치지 않고 바로 실행하므로, 게임 스레드가 결과를 기다려도 교착되지 않습니다.
+ * 워커 스레드에서 결과를 기다리는 동안 게임 스레드가 그 워커를 기다리면 교착되므로 주의해야 합니다.
+ *
+ * @note 요청은 어느 스레드에서나 할 수 있고, 요청한 함수는 항상 게임 스레드에서 실행됩니다.
+ *       Shutdown 이후의 요청은 assert합니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageGameThreadDispatcher
+{
+public:
+    static FEditorPackageGameThreadDispatcher& Get();
+
+    /** 코어 틱에 대기열 처리를 등록합니다. */
+    void Initialize();
+
+    /** 남은 요청을 모두 실행하고 틱 등록을 해제합니다. */
+    void Shutdown();
+
+    /**
+     * Callable을 게임 스레드에서 실행합니다.
+     *
+     * @param Callable 게임 스레드에서 실행할 함수. 반환값이 TFuture의 결과가 됩니다.
+     * @return 게임 스레드에서 완료되는 결과.
+     */
+    template<typename CallableType>
+    auto Dispatch(CallableType&& Callable) -> TFuture<decltype(Forward<CallableType>(Callable)())>
+    {
+        using ResultType = decltype(Forward<CallableType>(Callable)());
+
+        TPromise<ResultType> Promise;
+        TFuture<ResultType> Future = Promise.GetFuture();
+
+        if (IsInGameThread())
+        {
+            SetPromiseValue(Promise, Forward<CallableType>(Callable));
+            return Future;
+        }
+
+        EnqueueRequest([Promise = MoveTemp(Promise), Callable = Forward<CallableType>(Callable)]() mutable
+            {
+                SetPromiseValue(Promise, MoveTemp(Callable));
+            });
+        return Future;
+    }
+
+    /** EditorPackageUtils::IsAssetRegistered를 게임 스레드에서 실행합니다. 같은 틱의 조회는 한 번에 처리합니다. */
+    TFuture<bool> IsAssetRegistered(const FSoftObjectPath& ObjectPath);
+
+    /** EditorPackageUtils::ResolveClassDefinition을 게임 스레드에서 실행합니다. */
+    TFuture<UClass*> ResolveClassDefinition(FName ModuleName, FName ClassName);
+
+    /** EditorPackageUtils::ResolveStructDefinition을 게임 스레드에서 실행합니다. */
+    TFuture<UScriptStruct*> ResolveStructDefinition(FName ModuleName, FName StructName);
+
+    /** 대기 중인 요청을 지금 모두 실행합니다. 게임 스레드에서만 호출할 수 있습니다. */
+    void Flush();
+
+    /** 아직 실행되지 않은 요청 수. */
+    int32 GetNumPending() const;
+
+private:
+    struct FRegistryQuery
+    {
+        FSoftObjectPath ObjectPath;
+        TPromise<bool> Promise;
+    };
+
+    void EnqueueRequest(TUniqueFunction<void()>&& Request);
+
+    bool Tick(float DeltaTime);
+
+    /** 대기열을 비우고 요청을 실행합니다. */
+    void ProcessPending();
+
+    TArray<TUniqueFunction<void()>> PendingRequests;
+    TArray<FRegistryQuery> PendingRegistryQueries;
+    mutable FCriticalSection PendingLock;
+
+    bool bShutdown = false;
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
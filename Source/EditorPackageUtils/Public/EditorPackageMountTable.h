@@ -0,0 +1,215 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
+#include <atomic>
+
+/** 콘텐츠 루트 하나. */
+struct FEditorPackageMountRoot
+{
+    /** 패키지 루트 이름. 예: "Game" */
+    FString RootName;
+
+    /** 절대 경로, '/' 구분자, 끝 '/' 없음. */
+    FString ContentDir;
+};
+
+/**
+ * 특정 시점의 콘텐츠 루트 목록과 조회 인덱스를 담은 변경 불가능한 스냅샷.
+ * 만든 뒤에는 바뀌지 않으므로 모든 조회 함수를 어느 스레드에서나 동시에 호출할 수 있습니다.
+ *
+ * 파일 경로 -> 패키지 이름 조회는 경로를 한 번만 훑으면서 디렉터리 경계마다 접두사 해시를 비교하고,
+ * 패키지 이름 -> 파일 경로 조회는 루트 이름 해시로 찾으므로 두 방향 모두 힙 할당 없이 수행됩니다.
+ * 경로 비교는 대소문자와 '/' '\' 구분자를 구분하지 않습니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageMountSnapshot
+{
+public:
+    /** @param InRoots 정규화된 콘텐츠 루트 목록. */
+    explicit FEditorPackageMountSnapshot(TArray<FEditorPackageMountRoot> InRoots);
+
+    /**
+     * 파일 시스템 경로가 속한 콘텐츠 루트를 찾습니다. 여러 루트가 겹치면 가장 긴 루트가 선택됩니다.
+     *
+     * @param FilePath 절대 파일 시스템 경로. 예: "C:/Unreal Projects/YourProject/Content/MyAsset"
+     * @param OutRootName 패키지 루트 이름. 예: "Game" 또는 "PluginName". 스냅샷이 살아 있는 동안만 유효합니다.
+     * @param OutRelativePath 콘텐츠 루트 이후의 경로 (앞쪽 구분자 제외). 예: "MyAsset"
+     * @return 인식된 콘텐츠 루트 내부의 경로이면 true.
+     */
+    bool FindPackageRoot(FStringView FilePath, FStringView& OutRootName, FStringView& OutRelativePath) const;
+
+    /**
+     * 패키지 이름이 속한 콘텐츠 디렉터리를 찾습니다. FindPackageRoot의 반대 방향 조회입니다.
+     *
+     * @param PackageName 패키지 이름. 예: "/Game/MyAsset/MyFile"
+     * @param OutContentDir 루트의 콘텐츠 디렉터리 (절대 경로, '/' 구분자, 끝 '/' 없음). 스냅샷이 살아 있는 동안만 유효합니다.
+     * @param OutRelativePath 루트 이후의 경로. 예: "MyAsset/MyFile"
+     * @return 등록된 루트의 패키지 이름이면 true.
+     */
+    bool FindContentDir(FStringView PackageName, FStringView& OutContentDir, FStringView& OutRelativePath) const;
+
+    /**
+     * 파일 시스템 경로를 패키지 이름으로 변환해 OutPackageName 뒤에 덧붙입니다.
+     * 상대 경로는 절대 경로로 변환한 뒤 조회하므로 이때만 할당이 발생합니다.
+     *
+     * @param Filename 파일 시스템 경로. 예: "C:/Unreal Projects/YourProject/Content/MyAsset/MyFile"
+     * @param OutPackageName 결과를 덧붙일 빌더. 예: "/Game/MyAsset/MyFile"
+     * @return 인식된 콘텐츠 루트 내부의 경로이면 true.
+     */
+    bool TryConvertFilenameToPackageName(FStringView Filename, FStringBuilderBase& OutPackageName) const;
+
+    /**
+     * 패키지 이름을 파일 시스템 경로로 변환해 OutFilename 뒤에 덧붙입니다.
+     *
+     * @param PackageName 패키지 이름. 예: "/PluginName/MyAsset/MyFile"
+     * @param OutFilename 결과를 덧붙일 빌더. 예: "C:/.../Plugins/Group/PluginName/Content/MyAsset/MyFile.uasset"
+     * @param Extension 파일 경로 끝에 붙일 확장자 (예: ".uasset"). 비어 있으면 붙이지 않습니다.
+     * @return 등록된 루트의 패키지 이름이면 true.
+     */
+    bool TryConvertPackageNameToFilename(FStringView PackageName, FStringBuilderBase& OutFilename, FStringView Extension = FStringView()) const;
+
+    const TArray<FEditorPackageMountRoot>& GetRoots() const { return Roots; }
+
+private:
+    /** 이름 해시로 루트를 찾습니다. 없으면 nullptr. */
+    const FEditorPackageMountRoot* FindRootByName(FStringView RootName) const;
+
+    static bool ContentDirEquals(FStringView Path, const FString& ContentDir);
+
+    TArray<FEditorPackageMountRoot> Roots;
+
+    /** 정규화된 ContentDir 해시 -> Roots 인덱스 */
+    TMultiMap<uint32, int32> PrefixHashToRoot;
+
+    /** 소문자로 정규화된 RootName 해시 -> Roots 인덱스 */
+    TMultiMap<uint32, int32> NameHashToRoot;
+
+    /** 가장 긴 ContentDir 길이. 이보다 긴 접두사는 해시를 계산하지 않습니다. */
+    int32 MaxContentDirLen = 0;
+};
+
+using FEditorPackageMountSnapshotRef = TSharedRef<const FEditorPackageMountSnapshot, ESPMode::ThreadSafe>;
+
+/**
+ * 콘텐츠 디렉터리(파일 시스템 경로)와 패키지 루트("/Game", "/PluginName")를 양방향으로 매핑하는 마운트 테이블.
+ * FPackageName에 등록된 마운트 포인트와 IPluginManager의 콘텐츠를 가진 플러그인(엔진 플러그인, 중첩 폴더의 플러그인 포함)으로
+ * 한 번 빌드되며, 이후에는 콘텐츠 경로가 마운트/언마운트될 때만 갱신됩니다.
+ *
+ * 조회는 FEditorPackageMountSnapshot으로 처리합니다. 테이블이 바뀔 때마다 새 스냅샷을 만들어 교체하므로,
+ * 워커 스레드는 GetSnapshot()으로 받은 스냅샷을 잠금 없이 계속 사용할 수 있고 이후의 마운트 변경은 다음 스냅샷부터 보입니다.
+ *
+ * 스레드 규칙 (check로 확인합니다):
+ * - 어느 스레드에서나: GetSnapshot, TryConvert*, Convert*  (호출 동안 스냅샷을 붙잡고 조회)
+ * - 게임 스레드에서만: 테이블 변경, 빌드, FindPackageRoot/FindContentDir (결과 뷰가 현재 스냅샷을 가리킴), GetRoots
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageMountTable
+{
+public:
+    using FMountRoot = FEditorPackageMountRoot;
+
+    static FEditorPackageMountTable& Get();
+
+    /**
+     * 콘텐츠 경로 마운트/언마운트 이벤트를 등록하고, 디스크 캐시에서 복원한 테이블이 없으면 테이블을 빌드합니다.
+     * 워커 스레드에서 발생한 마운트 이벤트는 게임 스레드로 넘겨 다음 틱에 반영합니다.
+     */
+    void Initialize();
+
+    /** 등록한 이벤트를 해제하고 테이블을 비웁니다. */
+    void Shutdown();
+
+    /**
+     * 현재 스냅샷을 반환합니다. 어느 스레드에서나 호출할 수 있습니다.
+     * 테이블이 아직 빌드되지 않았으면 게임 스레드에서는 빌드하고, 워커 스레드에서는 assert합니다.
+     */
+    FEditorPackageMountSnapshotRef GetSnapshot();
+
+    /** 현재 스냅샷의 FindPackageRoot. 결과 뷰는 다음 테이블 변경 전까지만 유효하므로 게임 스레드에서만 호출합니다. */
+    bool FindPackageRoot(FStringView FilePath, FStringView& OutRootName, FStringView& OutRelativePath);
+
+    /** 현재 스냅샷의 FindContentDir. 결과 뷰는 다음 테이블 변경 전까지만 유효하므로 게임 스레드에서만 호출합니다. */
+    bool FindContentDir(FStringView PackageName, FStringView& OutContentDir, FStringView& OutRelativePath);
+
+    /** 현재 스냅샷으로 파일 시스템 경로를 패키지 이름으로 변환합니다. 어느 스레드에서나 호출할 수 있습니다. */
+    bool TryConvertFilenameToPackageName(FStringView Filename, FStringBuilderBase& OutPackageName);
+
+    /** 현재 스냅샷으로 패키지 이름을 파일 시스템 경로로 변환합니다. 어느 스레드에서나 호출할 수 있습니다. */
+    bool TryConvertPackageNameToFilename(FStringView PackageName, FStringBuilderBase& OutFilename, FStringView Extension = FStringView());
+
+    /**
+     * 여러 파일 경로를 한 번에 패키지 이름으로 변환합니다. 항목이 많으면 워커 스레드로 나눠 처리합니다.
+     * 어느 스레드에서나 호출할 수 있습니다.
+     *
+     * @param Filenames 변환할 파일 시스템 경로 목록.
+     * @param OutPackageNames Filenames와 같은 순서의 패키지 이름. 변환하지 못한 항목은 빈 문자열.
+     * @return 변환한 항목 수.
+     */
+    int32 ConvertFilenamesToPackageNames(TArrayView<const FString> Filenames, TArray<FString>& OutPackageNames);
+
+    /**
+     * 여러 패키지 이름을 한 번에 파일 시스템 경로로 변환합니다. 항목이 많으면 워커 스레드로 나눠 처리합니다.
+     * 어느 스레드에서나 호출할 수 있습니다.
+     *
+     * @param PackageNames 변환할 패키지 이름 목록.
+     * @param OutFilenames PackageNames와 같은 순서의 파일 경로. 변환하지 못한 항목은 빈 문자열.
+     * @param Extension 파일 경로 끝에 붙일 확장자 (예: ".uasset").
+     * @return 변환한 항목 수.
+     */
+    int32 ConvertPackageNamesToFilenames(TArrayView<const FString> PackageNames, TArray<FString>& OutFilenames, FStringView Extension);
+
+    /**
+     * 콘텐츠 루트를 추가합니다. 같은 이름의 루트가 이미 있으면 교체합니다.
+     *
+     * @param RootName 패키지 루트 이름 (앞뒤 '/' 제외).
+     * @param ContentDir 콘텐츠 디렉터리의 파일 시스템 경로. 상대 경로는 절대 경로로 변환됩니다.
+     */
+    void AddMountRoot(const FString& RootName, const FString& ContentDir);
+
+    /** 콘텐츠 루트를 제거합니다. */
+    void RemoveMountRoot(const FString& RootName);
+
+    /** FPackageName 마운트 포인트와 활성화된 플러그인 정보로 테이블을 처음부터 다시 빌드합니다. */
+    void Rebuild();
+
+    /** 테이블이 아직 빌드되지 않았으면 빌드합니다. 워커 스레드에서 조회하기 전에 게임 스레드에서 호출합니다. */
+    void EnsureBuilt();
+
+    /** 현재 등록된 콘텐츠 루트. */
+    const TArray<FMountRoot>& GetRoots() const
+    {
+        check(IsInGameThread());
+        return Roots;
+    }
+
+    /** 콘텐츠 루트 목록을 통째로 교체하고 스냅샷을 다시 만듭니다. 디스크 캐시에서 복원할 때 사용합니다. */
+    void SetRoots(TArray<FMountRoot>&& InRoots);
+
+private:
+    void OnContentPathMounted(const FString& AssetPath, const FString& ContentPath);
+    void OnContentPathDismounted(const FString& AssetPath, const FString& ContentPath);
+
+    /** 테이블 변경을 게임 스레드에서 실행합니다. 다른 스레드에서 호출하면 게임 스레드 작업으로 넘깁니다. */
+    void RunOnGameThread(TUniqueFunction<void()>&& Update);
+
+    /** 루트를 중복 없이 추가합니다. 스냅샷은 다시 만들지 않습니다. */
+    void AddRootNoIndex(const FString& RootName, const FString& ContentDir);
+
+    /** Roots로 새 스냅샷을 만들어 교체합니다. */
+    void PublishSnapshot();
+
+    /** 게임 스레드에서 편집하는 루트 목록. 조회에는 사용하지 않습니다. */
+    TArray<FMountRoot> Roots;
+
+    /** 현재 스냅샷. 교체와 복사만 SnapshotLock으로 보호합니다. */
+    TSharedPtr<const FEditorPackageMountSnapshot, ESPMode::ThreadSafe> Snapshot;
+    mutable FRWLock SnapshotLock;
+
+    /** 게임 스레드로 넘겼지만 아직 실행하지 않은 테이블 변경 수. */
+    std::atomic<int32> NumPendingUpdates{ 0 };
+
+    FDelegateHandle ContentPathMountedHandle;
+    FDelegateHandle ContentPathDismountedHandle;
+};
@@ -0,0 +1,170 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformTime.h"
+
+class UObject;
+class UPackage;
+
+/**
+ * 패키지 저장 파이프라인의 단계.
+ */
+enum class EEditorPackageSavePhase : uint8
+{
+    /** 파일 시스템 경로 -> 패키지 경로 변환. */
+    PathConversion,
+
+    /** Asset Registry 등록 여부 조회와 AssetCreated 알림. */
+    Registry,
+
+    /** 패키지 찾기/생성과 오브젝트 이동(Rename). */
+    Rename,
+
+    /** UPackage::Save/SaveConcurrent의 직렬화. */
+    Serialization,
+
+    /** 직렬화가 끝난 뒤 이 저장의 파일 기록을 기다린 시간. 디렉터리 생성은 포함하지 않습니다. */
+    FileIO,
+
+    /** 저장 전에 다른 호출자가 남긴 비동기 파일 기록을 기다린 시간. 이 패키지의 비용이 아니므로 합계에서 제외합니다. */
+    WriteDrain,
+
+    Num
+};
+
+/**
+ * 패키지 하나의 단계별 소요 시간 (사이클).
+ */
+struct FEditorPackageSaveTiming
+{
+    uint64 PhaseCycles[(int32)EEditorPackageSavePhase::Num] = {};
+
+    void Add(EEditorPackageSavePhase Phase, uint64 Cycles) { PhaseCycles[(int32)Phase] += Cycles; }
+
+    /** WriteDrain을 뺀 단계별 시간의 합. */
+    uint64 GetTotalCycles() const
+    {
+        uint64 Total = 0;
+        for (uint64 Cycles : PhaseCycles)
+        {
+            Total += Cycles;
+        }
+        return Total - PhaseCycles[(int32)EEditorPackageSavePhase::WriteDrain];
+    }
+};
+
+/**
+ * 생성부터 소멸까지의 시간을 Timing의 한 단계에 더합니다. Timing이 nullptr이면 아무것도 하지 않습니다.
+ */
+class FEditorPackageSavePhaseScope
+{
+public:
+    FEditorPackageSavePhaseScope(FEditorPackageSaveTiming* InTiming, EEditorPackageSavePhase InPhase)
+        : Timing(InTiming)
+        , Phase(InPhase)
+        , StartCycles(InTiming ? FPlatformTime::Cycles64() : 0)
+    {
+    }
+
+    ~FEditorPackageSavePhaseScope()
+    {
+        if (Timing)
+        {
+            Timing->Add(Phase, FPlatformTime::Cycles64() - StartCycles);
+        }
+    }
+
+private:
+    FEditorPackageSaveTiming* Timing;
+    EEditorPackageSavePhase Phase;
+    uint64 StartCycles;
+};
+
+/**
+ * 세션 동안의 패키지 저장 비용을 단계별, 에셋 클래스별, 패키지별로 집계하는 저장 프로파일러.
+ *
+ * EditorPackageUtils.SaveProfiler 콘솔 변수가 1일 때만 기록합니다. 켜져 있으면 동기 저장 함수들이
+ * 직렬화와 파일 기록을 나눠 재기 위해 SAVE_Async로 저장한 뒤 파일 기록을 기다리고,
+ * 에셋의 직렬화 크기(하위 오브젝트 포함 스크립트 프로퍼티 바이트)를 따로 계산하므로 저장이 약간 느려집니다.
+ * 파일 기록 대기는 다른 호출자(SAVE_Async 저장 등)의 기록까지 기다리므로, 저장 전에 남아 있던 기록을 먼저 기다려
+ * WriteDrain 열에 따로 기록합니다. WriteDrain은 합계와 가장 느린 패키지 순위에 포함하지 않습니다.
+ * 여러 패키지를 한 번에 저장한 경우 배치의 직렬화/파일 기록 시간은 파일 크기 비율로 패키지에 나눕니다.
+ *
+ * 콘솔 명령:
+ *   EditorPackageUtils.SaveProfiler 0|1           - 기록을 끄거나 켭니다 (기본: 0)
+ *   EditorPackageUtils.SaveReport [TopN] [File]  - 보고서를 로그에 출력하고 CSV로 저장 (기본: 10, Saved/Profiling/EditorPackageSaveReport.csv)
+ *   EditorPackageUtils.ResetSaveReport           - 집계 초기화
+ *
+ * @note 기록과 보고서 생성은 어느 스레드에서나 할 수 있습니다. 직렬화 크기는 게임 스레드에서 계산합니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageSaveProfiler
+{
+public:
+    /** 집계 단위 하나 (세션 전체, 에셋 클래스, 패키지). */
+    struct FTotals
+    {
+        int64 Count = 0;
+        int64 BytesWritten = 0;
+        int64 SerializedSize = 0;
+        uint64 PhaseCycles[(int32)EEditorPackageSavePhase::Num] = {};
+
+        /** WriteDrain을 뺀 단계별 시간의 합. */
+        uint64 GetTotalCycles() const;
+    };
+
+    static FEditorPackageSaveProfiler& Get();
+
+    static bool IsEnabled();
+
+    static const TCHAR* GetPhaseName(EEditorPackageSavePhase Phase);
+
+    /**
+     * 저장한 패키지 하나를 기록합니다.
+     *
+     * @param Package 저장한 패키지.
+     * @param Asset 패키지의 에셋. 클래스별 집계와 직렬화 크기 계산에 사용합니다.
+     * @param Timing 단계별 소요 시간.
+     * @param BytesWritten 디스크에 기록한 바이트 수. 기록을 건너뛰었으면 0.
+     */
+    void RecordPackage(const UPackage* Package, UObject* Asset, const FEditorPackageSaveTiming& Timing, int64 BytesWritten);
+
+    void Reset();
+
+    /** 단계별 합계, 클래스별 합계, 가장 느린 TopN개 패키지를 로그에 출력합니다. */
+    void LogReport(int32 TopN) const;
+
+    /** LogReport와 같은 내용을 CSV 문자열로 만듭니다. Section 열로 Phase/Class/Package 행을 구분합니다. */
+    FString ToCsv(int32 TopN) const;
+
+    bool WriteCsv(const FString& Filename, int32 TopN) const;
+
+    static FString GetDefaultCsvFilename();
+
+    /** 보관하는 가장 느린 패키지 수. 보고서의 TopN 상한입니다. */
+    static constexpr int32 MaxSlowestPackages = 100;
+
+private:
+    struct FPackageRecord
+    {
+        FName PackageName;
+        FName ClassName;
+        FTotals Totals;
+    };
+
+    /** 에셋의 스크립트 프로퍼티를 직렬화했을 때의 바이트 수를 셉니다. */
+    static int64 ComputeSerializedSize(UObject* Asset);
+
+    /** Slowest를 TotalCycles 내림차순으로 정렬한 사본에서 최대 TopN개를 반환합니다. */
+    TArray<FPackageRecord> GetSlowest(int32 TopN) const;
+
+    FTotals SessionTotals;
+    TMap<FName, FTotals> ClassTotals;
+
+    /** 가장 느린 패키지들. TotalCycles 기준 최소 힙이므로 가장 빠른 항목이 맨 앞에 있습니다. */
+    TArray<FPackageRecord> Slowest;
+
+    mutable FCriticalSection Lock;
+};
@@ -0,0 +1,117 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorPackageUtilsTypes.h"
+#include "UObject/WeakObjectPtr.h"
+
+/**
+ * 여러 패키지를 저장하는 동안 파일 시스템 메타데이터 호출을 줄이는 저장 세션.
+ *
+ * - 존재를 확인했거나 만든 디렉터리(와 그 상위 디렉터리)를 기억해 DirectoryExists/MakeDirectory를 한 번만 호출합니다.
+ *   세션이 살아 있는 동안에는 SaveAssetToPackage 등 다른 저장 함수도 같은 디렉터리 캐시를 사용합니다.
+ * - bStageInMemory가 켜져 있으면 패키지를 로컬 임시 디렉터리에 직렬화한 뒤 바이트를 메모리에 모아 두었다가,
+ *   Flush 때 패키지마다 "<대상>.tmp"에 한 번의 순차 쓰기로 기록하고 최종 경로로 교체합니다.
+ *   네트워크 드라이브에는 패키지당 파일 생성, 쓰기, 이름 변경만 발생하며 기록 중 중단되어도 기존 파일은 깨지지 않습니다.
+ *   임시 디렉터리에 직렬화할 때 패키지의 더티 표시가 지워지므로, 스테이징한 패키지는 바이트가 대상 경로에 기록되기 전부터
+ *   저장된 것으로 표시됩니다. 기록에 실패하면 Flush가 다시 더티로 표시합니다.
+ * - 세션별 I/O 통계를 GetStats로 제공합니다.
+ *
+ * 사용 예:
+ * @code
+ *     FEditorPackageSaveSession Session;
+ *     for (...) { Session.SaveAsset(Object, Directory, Name); }
+ *     Session.Flush();
+ *     Session.LogStats();
+ * @endcode
+ *
+ * @note 게임 스레드에서만 사용해야 합니다. 소멸자에서 남은 패키지를 기록합니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageSaveSession
+{
+public:
+    struct FOptions
+    {
+        /** 패키지 바이트를 메모리에 모았다가 Flush 때 기록합니다. false이면 UPackage::Save로 바로 기록합니다. */
+        bool bStageInMemory = true;
+
+        /** 메모리에 모은 바이트가 이 값을 넘으면 자동으로 Flush합니다. */
+        int64 MaxStagedBytes = 256 * 1024 * 1024;
+    };
+
+    FEditorPackageSaveSession();
+    explicit FEditorPackageSaveSession(const FOptions& InOptions);
+    ~FEditorPackageSaveSession();
+
+    FEditorPackageSaveSession(const FEditorPackageSaveSession&) = delete;
+    FEditorPackageSaveSession& operator=(const FEditorPackageSaveSession&) = delete;
+
+    /** 게임 스레드에서 가장 최근에 만든 살아 있는 세션. 없거나 다른 스레드면 nullptr. */
+    static FEditorPackageSaveSession* GetCurrent();
+
+    /**
+     * SaveObject를 패키지로 저장합니다. 메모리 스테이징을 사용하면 실제 기록은 Flush 때 일어나며,
+     * 이때 결과의 FileSize는 기록할 바이트 수입니다.
+     * 스테이징한 패키지는 이 함수가 반환될 때 이미 더티 표시가 지워져 있으며, Flush에서 기록에 실패하면 다시 더티로 표시됩니다.
+     *
+     * @param SaveObject 저장할 UObject.
+     * @param SaveDirectory 파일 시스템 상의 저장할 디렉터리 경로.
+     * @param FileName 저장할 파일 이름 (확장자는 필요하지 않음).
+     * @return 저장 결과. 스테이징한 패키지는 직렬화에 성공하면 bSuccess가 true입니다.
+     */
+    FEditorPackageSaveResult SaveAsset(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName);
+
+    /**
+     * 디렉터리가 없으면 생성합니다. 한 번 확인한 디렉터리는 다시 확인하지 않습니다.
+     *
+     * @return 디렉터리가 존재하거나 생성에 성공하면 true.
+     */
+    bool EnsureDirectoryExists(const FString& Directory);
+
+    /**
+     * 메모리에 모은 패키지를 모두 기록합니다.
+     * 기록에 실패한 패키지는 다시 더티로 표시하므로 에디터에서 다시 저장할 수 있습니다.
+     *
+     * @return 모든 패키지를 기록했으면 true.
+     */
+    bool Flush();
+
+    /** 기록 대기 중인 패키지 수. */
+    int32 GetNumStaged() const { return StagedPackages.Num(); }
+
+    const FEditorPackageSaveSessionStats& GetStats() const { return Stats; }
+
+    /** 세션 통계를 로그에 출력합니다. */
+    void LogStats() const;
+
+private:
+    struct FStagedPackage
+    {
+        TWeakObjectPtr<UPackage> Package;
+        FString Filename;
+        TArray64<uint8> Bytes;
+    };
+
+    /** 직렬화 결과를 받을 로컬 임시 파일 경로. */
+    FString MakeStagingFilename(const FString& Filename);
+
+    /** 패키지 하나를 "<대상>.tmp"에 기록한 뒤 대상 경로로 교체합니다. */
+    bool WriteStagedPackage(const FStagedPackage& Staged);
+
+    FOptions Options;
+    FEditorPackageSaveSessionStats Stats;
+
+    /** 존재가 확인된 디렉터리. 정규화된 경로이며 대소문자를 구분하지 않습니다. */
+    TSet<FString> KnownDirectories;
+
+    TArray<FStagedPackage> StagedPackages;
+    int64 StagedBytes = 0;
+
+    /** 로컬 임시 디렉터리. 처음 스테이징할 때 생성합니다. */
+    FString StagingDirectory;
+    int32 NumStagingFiles = 0;
+
+    /** 이 세션이 만들어지기 전에 현재 세션이었던 세션. */
+    FEditorPackageSaveSession* PreviousSession = nullptr;
+};
@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorPackageUtilsTypes.h"
+
+/**
+ * 많은 수의 생성 오브젝트를 하나씩 저장하면서 메모리 사용량을 예산 안으로 유지하는 스트리밍 저장기.
+ *
+ * 패키지 저장에 성공하면 바로 오브젝트와 패키지의 RF_Standalone과 루트 등록을 해제해 GC 대상으로 만들고,
+ * 물리 메모리 사용량(RSS)을 관찰해 GC 간격을 조정합니다.
+ * - 마지막 GC 이후 패키지당 메모리 증가량으로 예산의 목표 비율에 도달할 때까지의 패키지 수를 계산해 다음 GC 간격으로 사용합니다.
+ * - 사용량이 예산을 넘으면 간격이 끝나지 않았어도 GC합니다. 단, 마지막 GC 이후 MinGCInterval개 이상 저장한 경우에만 GC합니다.
+ * - IncrementalPurgeTimeLimit이 0보다 크면 GC는 도달 가능성 분석만 하고, 오브젝트 정리는 이후 저장마다 시간을 나눠 수행합니다.
+ *
+ * 저장에 성공한 오브젝트는 다시 사용하면 안 됩니다. 에디터의 Undo 버퍼가 참조하는 오브젝트는 해제되지 않습니다.
+ * 저장에 실패한 오브젝트와 패키지는 해제하지 않고 더티 상태로 남겨 두므로, 호출자가 다시 저장하거나 정리해야 합니다.
+ *
+ * @note 게임 스레드에서만 사용해야 합니다. 소멸자에서 남은 정리를 마칩니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageStreamingSaver
+{
+public:
+    struct FOptions
+    {
+        /** 물리 메모리 예산 (바이트). */
+        int64 MemoryBudgetBytes = 8ll * 1024 * 1024 * 1024;
+
+        /** 다음 GC 시점을 예산의 이 비율에 맞춥니다. */
+        double TargetBudgetRatio = 0.75;
+
+        /** GC 간격의 하한과 상한 (패키지 수). */
+        int32 MinGCInterval = 16;
+        int32 MaxGCInterval = 8192;
+
+        /** 저장마다 미뤄 둔 오브젝트 정리에 쓸 최대 시간 (초). 0이면 GC 때 한 번에 정리합니다. */
+        double IncrementalPurgeTimeLimit = 0.002;
+    };
+
+    FEditorPackageStreamingSaver();
+    explicit FEditorPackageStreamingSaver(const FOptions& InOptions);
+    ~FEditorPackageStreamingSaver();
+
+    FEditorPackageStreamingSaver(const FEditorPackageStreamingSaver&) = delete;
+    FEditorPackageStreamingSaver& operator=(const FEditorPackageStreamingSaver&) = delete;
+
+    /**
+     * SaveObject를 패키지로 저장하고, 성공하면 GC 대상으로 돌립니다. 필요하면 GC를 실행합니다.
+     *
+     * @param SaveObject 저장할 UObject. 저장에 성공하면 호출 후 참조를 버려야 합니다.
+     * @param SaveDirectory 파일 시스템 상의 저장할 디렉터리 경로.
+     * @param FileName 저장할 파일 이름 (확장자는 필요하지 않음).
+     * @return 저장 결과. Package는 다음 GC 이후 유효하지 않을 수 있습니다.
+     */
+    FEditorPackageSaveResult Save(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName);
+
+    /** 마지막 GC를 실행하고 미뤄 둔 정리를 모두 마칩니다. */
+    void Finish();
+
+    const FEditorPackageStreamingSaveStats& GetStats() const { return Stats; }
+
+    /** 저장 및 GC 통계를 로그에 출력합니다. */
+    void LogStats() const;
+
+private:
+    /** 저장한 오브젝트와 패키지가 GC될 수 있도록 플래그와 루트 등록을 해제합니다. 디스크에 기록한 패키지에만 사용해야 합니다. */
+    static void ReleaseForGC(UObject* SaveObject, UPackage* Package);
+
+    /** 현재 메모리 사용량을 기록하고 GC가 필요하면 실행합니다. 예산을 넘어도 MinGCInterval보다 자주 GC하지 않습니다. */
+    void UpdateMemoryAndMaybeCollect();
+
+    void CollectGarbageNow(bool bFullPurge);
+
+    /** 마지막 GC 이후의 패키지당 메모리 증가량으로 다음 GC 간격을 계산합니다. */
+    void UpdateGCInterval(int64 UsedPhysical);
+
+    FOptions Options;
+    FEditorPackageStreamingSaveStats Stats;
+
+    int32 PackagesSinceGC = 0;
+    bool bWarnedBudgetTooSmall = false;
+};
@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class SNotificationItem;
+
+/**
+ * 시간 분할 배치 작업의 실행 결과.
+ */
+struct FEditorPackageBatchJobResult
+{
+    /** 처리한 항목 수. 취소되면 NumItems보다 작을 수 있습니다. */
+    int32 NumProcessed = 0;
+
+    int32 NumItems = 0;
+
+    bool bCanceled = false;
+
+    /** 항목 처리에 실제로 쓴 시간(초). 틱 사이의 대기 시간은 포함하지 않습니다. */
+    double ProcessSeconds = 0.0;
+
+    /** 제출부터 완료까지 걸린 전체 시간(초). */
+    double TotalSeconds = 0.0;
+};
+
+DECLARE_DELEGATE_OneParam(FOnEditorPackageBatchJobFinished, const FEditorPackageBatchJobResult& /*Result*/);
+
+/**
+ * 항목 [StartIndex, StartIndex + Count)를 처리하는 함수.
+ * 여러 항목을 한 번에 넘기므로 SaveAssetsToPackages, AreAssetsRegistered처럼 일괄 처리 함수를 그대로 사용할 수 있습니다.
+ */
+DECLARE_DELEGATE_TwoParams(FOnEditorPackageBatchJobSlice, int32 /*StartIndex*/, int32 /*Count*/);
+
+/**
+ * FEditorPackageTimeSlicedRunner에 제출한 배치 작업의 핸들.
+ * 진행 상황 조회와 일시정지, 재개, 취소에 사용합니다.
+ *
+ * @note 게임 스레드에서만 사용해야 합니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageBatchJob
+{
+public:
+    /** 다음 틱부터 항목 처리를 멈춥니다. 진행 노티피케이션은 남아 있습니다. */
+    void Pause();
+
+    void Resume();
+
+    /** 다음 틱에 작업을 끝내고 bCanceled 결과로 완료 콜백을 호출합니다. 이미 처리한 항목은 되돌리지 않습니다. */
+    void Cancel();
+
+    bool IsPaused() const { return bPaused; }
+    bool IsCanceled() const { return bCanceled; }
+    bool IsFinished() const { return bFinished; }
+
+    int32 GetNumProcessed() const { return NumProcessed; }
+    int32 GetNumItems() const { return NumItems; }
+
+    /** 지금까지 측정한 항목당 평균 처리 시간(밀리초). */
+    double GetAverageItemMs() const { return AverageItemSeconds * 1000.0; }
+
+private:
+    friend class FEditorPackageTimeSlicedRunner;
+
+    FEditorPackageBatchJob() = default;
+
+    /** 노티피케이션 상태를 일시정지 여부에 맞춥니다. */
+    void UpdateNotificationState();
+
+    FText DisplayName;
+    int32 NumItems = 0;
+    int32 NumProcessed = 0;
+
+    FOnEditorPackageBatchJobSlice ProcessSlice;
+    FOnEditorPackageBatchJobFinished OnFinished;
+
+    /** 항목당 처리 시간의 지수 이동 평균. 아직 측정하지 않았으면 0. */
+    double AverageItemSeconds = 0.0;
+
+    double ProcessSeconds = 0.0;
+    double SubmitTime = 0.0;
+
+    bool bPaused = false;
+    bool bCanceled = false;
+    bool bFinished = false;
+
+    TSharedPtr<SNotificationItem> NotificationItem;
+};
+
+/**
+ * 긴 배치 작업을 에디터 틱마다 정해진 시간만큼 나눠 처리하는 러너.
+ *
+ * 대량 저장이나 타입 조회처럼 게임 스레드에서 한 번에 실행하면 에디터가 멈추는 작업을 항목 단위로 제출하면,
+ * 틱마다 FrameBudgetMs 안에서 처리할 수 있는 만큼만 실행하고 나머지는 다음 틱으로 넘깁니다.
+ * 한 번에 처리할 항목 수(슬라이스)는 측정한 항목당 처리 시간으로 조절하므로, 항목 비용을 미리 알 필요가 없습니다.
+ * 작업마다 진행 노티피케이션을 표시하며 노티피케이션의 버튼이나 핸들로 일시정지, 재개, 취소할 수 있습니다.
+ *
+ * 여러 작업은 제출 순서대로 같은 틱 예산을 나눠 씁니다. 완료 콜백은 항상 게임 스레드에서 호출됩니다.
+ *
+ * 콘솔 명령:
+ *   EditorPackageUtils.ListBatchJobs    - 진행 중인 작업 목록을 로그에 출력
+ *   EditorPackageUtils.CancelBatchJobs  - 진행 중인 작업을 모두 취소
+ *
+ * @note 게임 스레드에서만 사용해야 합니다. 커맨드렛처럼 틱이 돌지 않는 환경에서는 Flush로 남은 작업을 완료해야 합니다.
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageTimeSlicedRunner
+{
+public:
+    static FEditorPackageTimeSlicedRunner& Get();
+
+    /** 코어 틱에 작업 처리를 등록합니다. */
+    void Initialize();
+
+    /** 남은 작업을 모두 취소하고 틱 등록을 해제합니다. */
+    void Shutdown();
+
+    /**
+     * 배치 작업을 제출합니다. 첫 항목은 다음 틱에 처리합니다.
+     *
+     * @param DisplayName 진행 노티피케이션에 표시할 작업 이름.
+     * @param NumItems 처리할 항목 수.
+     * @param ProcessSlice 항목 구간을 처리하는 함수. 항목이 참조하는 UObject는 작업이 끝날 때까지 호출자가 유지해야 합니다.
+     * @param OnFinished 작업이 끝나거나 취소되면 호출됩니다.
+     * @return 작업 핸들.
+     */
+    TSharedRef<FEditorPackageBatchJob> Submit(const FText& DisplayName, int32 NumItems, FOnEditorPackageBatchJobSlice ProcessSlice, FOnEditorPackageBatchJobFinished OnFinished = FOnEditorPackageBatchJobFinished());
+
+    /** 일시정지되지 않은 작업을 시간 제한 없이 모두 처리합니다. */
+    void Flush();
+
+    /** 진행 중인 모든 작업을 취소합니다. */
+    void CancelAll();
+
+    /** 완료되지 않은 작업 목록. */
+    const TArray<TSharedRef<FEditorPackageBatchJob>>& GetJobs() const { return Jobs; }
+
+    /** 틱 한 번에 모든 작업이 쓸 수 있는 처리 시간(밀리초). */
+    double FrameBudgetMs = 8.0;
+
+    /** 슬라이스 하나의 최대 항목 수. 항목당 시간이 매우 짧을 때 한 번에 넘기는 구간의 크기를 제한합니다. */
+    int32 MaxSliceSize = 1024;
+
+private:
+    bool Tick(float DeltaTime);
+
+    /**
+     * Job의 항목을 BudgetSeconds 안에서 처리합니다.
+     *
+     * @return 실제로 쓴 시간(초).
+     */
+    double ProcessJob(FEditorPackageBatchJob& Job, double BudgetSeconds);
+
+    /** 모든 항목을 처리했거나 취소된 작업을 목록에서 빼고 노티피케이션과 완료 콜백을 처리합니다. */
+    void FinishCompletedJobs();
+
+    /** 남은 예산과 항목당 평균 시간으로 다음 슬라이스의 항목 수를 정합니다. */
+    int32 GetSliceSize(const FEditorPackageBatchJob& Job, double BudgetSeconds) const;
+
+    TArray<TSharedRef<FEditorPackageBatchJob>> Jobs;
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
@@ -3,22 +3,64 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "EditorPackageUtilsTypes.h"
+#include "Async/Future.h"
+#include "Misc/StringBuilder.h"
+#include "UObject/SoftObjectPath.h"
+
+class FEditorPackageBatchJob;
 
 /**
- * 
+ * 에디터에서 패키지 경로 변환, 타입 조회, 에셋 저장, 빌드를 처리하는 함수 모음.
+ *
+ * 스레드 규칙 (check로 확인합니다):
+ * - 어느 스레드에서나: ExtractModuleNameFromPath, EnsureUAssetExtension, ConvertFilePathToPackagePath,
+ *   ConvertFilePathsToPackagePaths, ConvertPackagePathsToFilePaths, PluginLongPackageNameToFilename,
+ *   ScanDirectoryForPackages (bQueryRegistry = false).
+ *   경로 변환은 FEditorPackageMountTable의 변경 불가능한 스냅샷으로 처리하므로 잠금 없이 동시에 호출할 수 있습니다.
+ * - 게임 스레드에서만: 그 밖의 모든 함수 (Asset Registry, 타입 조회, 패키지 생성/저장, 빌드).
+ *   대량 저장처럼 오래 걸리는 작업은 SaveAssetsToPackagesTimeSliced나 FEditorPackageTimeSlicedRunner로 틱마다 나눠 실행합니다.
+ *   워커 스레드에서는 FEditorPackageGameThreadDispatcher로 요청하면 한 번의 게임 스레드 틱에 모아 처리합니다.
  */
 class EDITORPACKAGEUTILS_API EditorPackageUtils
 {
 public:
     static FString ExtractModuleNameFromPath(const FString& FilePath);
+    static bool ExtractModuleNameFromPath(FStringView FilePath, FStringView& OutModuleName);
     static FString EnsureUAssetExtension(const FString& FilePath);
+    static void EnsureUAssetExtension(FStringView FilePath, FStringBuilderBase& OutFilePath);
     static FString ConvertFilePathToPackagePath(const FString& FilePath);
+    static int32 ConvertFilePathsToPackagePaths(TArrayView<const FString> FilePaths, TArray<FString>& OutPackagePaths);
+    static int32 ConvertPackagePathsToFilePaths(TArrayView<const FString> PackagePaths, TArray<FString>& OutFilePaths);
+    static bool ScanDirectoryForPackages(const FString& RootDirectory, FEditorPackageScanResult& OutResult, bool bQueryRegistry = true);
     static FString PluginLongPackageNameToFilename(const FString& FullPackagePath);
+    static bool PluginLongPackageNameToFilename(FStringView FullPackagePath, FStringBuilderBase& OutFilename);
     static bool IsAssetAlreadyRegistered(const FString& AssetPath);
+    static bool IsAssetRegistered(const FSoftObjectPath& ObjectPath);
+    static int32 AreAssetsRegistered(TArrayView<const FSoftObjectPath> ObjectPaths, TBitArray<>& OutRegistered);
     static UScriptStruct* LoadStructDefinitionByName(const FString& ModuleName, const FString& StructName);
     static UClass* LoadClassDefinitionByName(const FString& ModuleName, const FString& ClassName);
+    static UScriptStruct* ResolveStructDefinition(FName ModuleName, FName StructName);
+    static UClass* ResolveClassDefinition(FName ModuleName, FName ClassName);
+    static int32 ResolveStructDefinitions(FName ModuleName, TArrayView<const FName> StructNames, TArray<UScriptStruct*>& OutStructs);
+    static int32 ResolveClassDefinitions(FName ModuleName, TArrayView<const FName> ClassNames, TArray<UClass*>& OutClasses);
     static void ExecuteBuildAndHotReload();
+    static void ExecuteBuildAndHotReloadAsync();
     static void RestartEditorWithProject(const FString& ProjectPath);
     static void StartBuildAndRestartEditor();
+    static int32 CreateAssetPackages(TArrayView<const FEditorPackageCreateItem> Items, TArray<FEditorPackageCreateResult>& OutResults);
+    static UObject* NewAssetInPackage(const FEditorPackageCreateResult& Created, UClass* Class, EObjectFlags Flags = RF_Public | RF_Standalone);
+
+    template<typename T>
+    static T* NewAssetInPackage(const FEditorPackageCreateResult& Created, EObjectFlags Flags = RF_Public | RF_Standalone)
+    {
+        return static_cast<T*>(NewAssetInPackage(Created, T::StaticClass(), Flags));
+    }
+
     static UPackage* SaveAssetToPackage(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName, EObjectFlags TopLevelFlags);
+    static FEditorPackageSaveResult SaveAssetToPackageIfChanged(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName, uint64 ContentHash = 0);
+    static TArray<FEditorPackageSaveResult> SaveAssetsToPackages(TArrayView<const FEditorPackageSaveItem> Items, EEditorPackageSaveMode SaveMode = EEditorPackageSaveMode::Always);
+    static TFuture<FEditorPackageSaveResult> SaveAssetToPackageAsync(UObject* SaveObject, const FString& SaveDirectory, const FString& FileName);
+    static TFuture<TArray<FEditorPackageSaveResult>> SaveAssetsToPackagesTimeSliced(TArrayView<const FEditorPackageSaveItem> Items, EEditorPackageSaveMode SaveMode = EEditorPackageSaveMode::Always, TSharedPtr<FEditorPackageBatchJob>* OutJob = nullptr);
+    static void FlushAsyncSaves();
 };
@@ -0,0 +1,16 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * LogEditorPackageUtils 카테고리의 컴파일 타임 최대 상세도.
+ * 경로 변환, 타입 조회, 저장 성공 같은 핫 패스 로그는 Verbose로 기록되므로
+ * Build.cs에서 EDITORPACKAGEUTILS_LOG_COMPILE_VERBOSITY=Log 를 정의하면 해당 로그는 컴파일 단계에서 제거됩니다.
+ */
+#ifndef EDITORPACKAGEUTILS_LOG_COMPILE_VERBOSITY
+#define EDITORPACKAGEUTILS_LOG_COMPILE_VERBOSITY All
+#endif
+
+EDITORPACKAGEUTILS_API DECLARE_LOG_CATEGORY_EXTERN(LogEditorPackageUtils, Log, EDITORPACKAGEUTILS_LOG_COMPILE_VERBOSITY);
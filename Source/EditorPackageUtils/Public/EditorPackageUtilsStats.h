@@ -0,0 +1,147 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+#include <atomic>
+
+/** 0으로 정의하면 EDITORPACKAGEUTILS_SCOPED_STAT 계측이 컴파일 단계에서 제거됩니다. */
+#ifndef EDITORPACKAGEUTILS_STATS
+#define EDITORPACKAGEUTILS_STATS 1
+#endif
+
+/** Unreal Insights에서 "EditorPackageUtils" 채널을 켜면 계측 구간이 CPU 트랙에 표시됩니다. */
+UE_TRACE_CHANNEL_EXTERN(EditorPackageUtilsChannel, EDITORPACKAGEUTILS_API);
+
+/** 계측 대상 함수 목록. */
+#define EDITORPACKAGEUTILS_STAT_LIST(Op) \
+    Op(ExtractModuleNameFromPath) \
+    Op(EnsureUAssetExtension) \
+    Op(ConvertFilePathToPackagePath) \
+    Op(ConvertFilePathsToPackagePaths) \
+    Op(ConvertPackagePathsToFilePaths) \
+    Op(ScanDirectoryForPackages) \
+    Op(PluginLongPackageNameToFilename) \
+    Op(IsAssetRegistered) \
+    Op(AreAssetsRegistered) \
+    Op(ResolveTypeDefinition) \
+    Op(ExecuteBuildAndHotReload) \
+    Op(CreateAssetPackages) \
+    Op(SaveAssetToPackage) \
+    Op(SaveAssetToPackageIfChanged) \
+    Op(SaveAssetsToPackages) \
+    Op(SaveAssetToPackageAsync) \
+    Op(SaveSessionSaveAsset) \
+    Op(SaveSessionFlush) \
+    Op(StreamingSave) \
+    Op(DispatchGameThreadBatch) \
+    Op(TimeSlicedRunnerTick)
+
+enum class EEditorPackageUtilsStat : uint8
+{
+#define EDITORPACKAGEUTILS_STAT_ENUM(Name) Name,
+    EDITORPACKAGEUTILS_STAT_LIST(EDITORPACKAGEUTILS_STAT_ENUM)
+#undef EDITORPACKAGEUTILS_STAT_ENUM
+    Num
+};
+
+/**
+ * EditorPackageUtils 공개 함수별 호출 횟수, 누적/p50/p99 지연 시간과 저장한 바이트 수를 집계합니다.
+ * 지연 시간은 옥타브당 4개 구간을 가진 로그 히스토그램으로 기록하므로 백분위수의 오차는 약 12% 이내입니다.
+ * 모든 기록은 원자적으로 처리되어 어느 스레드에서나 호출할 수 있습니다.
+ *
+ * 콘솔 명령:
+ *   EditorPackageUtils.DumpStats [Filename]  - 통계를 로그에 출력하고 CSV로 저장 (기본: Saved/Profiling/EditorPackageUtilsStats.csv)
+ *   EditorPackageUtils.ResetStats            - 통계 초기화
+ */
+class EDITORPACKAGEUTILS_API FEditorPackageUtilsStats
+{
+public:
+    struct FSummary
+    {
+        uint64 Calls = 0;
+        double TotalMs = 0.0;
+        double P50Ms = 0.0;
+        double P99Ms = 0.0;
+    };
+
+    static FEditorPackageUtilsStats& Get();
+
+    static const TCHAR* GetStatName(EEditorPackageUtilsStat Stat);
+
+    void RecordCall(EEditorPackageUtilsStat Stat, uint64 Cycles);
+    void RecordBytesSaved(int64 Bytes);
+
+    /** OnlyIfChanged 저장에서 지문을 비교한 결과를 기록합니다. */
+    void RecordFingerprintCheck(bool bSkipped);
+
+    FSummary GetSummary(EEditorPackageUtilsStat Stat) const;
+    int64 GetBytesSaved() const { return BytesSaved.load(std::memory_order_relaxed); }
+    int64 GetPackagesChecked() const { return PackagesChecked.load(std::memory_order_relaxed); }
+    int64 GetPackagesSkipped() const { return PackagesSkipped.load(std::memory_order_relaxed); }
+
+    /** 지문을 비교한 패키지 중 기록을 건너뛴 비율 (0~1). */
+    double GetSkipRatio() const;
+
+    void Reset();
+
+    /** 함수별 통계를 CSV 문자열로 만듭니다. */
+    FString ToCsv() const;
+
+    /** 함수별 통계를 CSV 파일로 저장합니다. */
+    bool WriteCsv(const FString& Filename) const;
+
+private:
+    static constexpr int32 SubBucketBits = 2;
+    static constexpr int32 NumBuckets = 64 << SubBucketBits;
+
+    struct FCounter
+    {
+        std::atomic<uint64> Calls{ 0 };
+        std::atomic<uint64> TotalCycles{ 0 };
+        std::atomic<uint64> Buckets[NumBuckets] = {};
+    };
+
+    static int32 GetBucketIndex(uint64 Cycles);
+    static uint64 GetBucketMidpoint(int32 BucketIndex);
+
+    double GetPercentileMs(const FCounter& Counter, uint64 Calls, double Percentile) const;
+
+    FCounter Counters[(int32)EEditorPackageUtilsStat::Num];
+    std::atomic<int64> BytesSaved{ 0 };
+    std::atomic<int64> PackagesChecked{ 0 };
+    std::atomic<int64> PackagesSkipped{ 0 };
+};
+
+/**
+ * 생성부터 소멸까지의 시간을 FEditorPackageUtilsStats에 기록합니다.
+ */
+class FEditorPackageUtilsScopedStat
+{
+public:
+    explicit FEditorPackageUtilsScopedStat(EEditorPackageUtilsStat InStat)
+        : Stat(InStat)
+        , StartCycles(FPlatformTime::Cycles64())
+    {
+    }
+
+    ~FEditorPackageUtilsScopedStat()
+    {
+        FEditorPackageUtilsStats::Get().RecordCall(Stat, FPlatformTime::Cycles64() - StartCycles);
+    }
+
+private:
+    EEditorPackageUtilsStat Stat;
+    uint64 StartCycles;
+};
+
+#if EDITORPACKAGEUTILS_STATS
+#define EDITORPACKAGEUTILS_SCOPED_STAT(StatName) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("EditorPackageUtils::" #StatName, EditorPackageUtilsChannel); \
+    FEditorPackageUtilsScopedStat PREPROCESSOR_JOIN(EditorPackageUtilsScopedStat_, __LINE__)(EEditorPackageUtilsStat::StatName)
+#else
+#define EDITORPACKAGEUTILS_SCOPED_STAT(StatName)
+#endif
@@ -0,0 +1,220 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UObject;
+class UPackage;
+
+/**
+ * 패키지 저장 방식.
+ */
+enum class EEditorPackageSaveMode : uint8
+{
+    /** 항상 패키지를 더티로 표시하고 디스크에 기록합니다. */
+    Always,
+
+    /** 내용 해시가 마지막 저장 때와 같으면 기록과 더티 표시를 건너뜁니다. */
+    OnlyIfChanged,
+};
+
+/**
+ * EditorPackageUtils::SaveAssetsToPackages 에 전달하는 저장 항목.
+ */
+struct FEditorPackageSaveItem
+{
+    /** 저장할 UObject. */
+    UObject* Object = nullptr;
+
+    /** 파일 시스템 상의 저장할 디렉터리 경로 (예: "C:/Unreal Projects/YourProject/Content/..."). */
+    FString SaveDirectory;
+
+    /** 저장할 파일 이름 (확장자는 필요하지 않음). */
+    FString FileName;
+
+    /** OnlyIfChanged 모드에서 사용할 내용 해시. 0이면 오브젝트를 직렬화해 계산합니다. */
+    uint64 ContentHash = 0;
+};
+
+/**
+ * 저장 항목 하나에 대한 저장 결과.
+ */
+struct FEditorPackageSaveResult
+{
+    /** 에셋이 저장된 패키지. 패키지 생성 전에 실패하면 nullptr. */
+    UPackage* Package = nullptr;
+
+    /** 저장된 파일 경로 (.uasset 포함). */
+    FString Filename;
+
+    /** 디스크에 기록된 바이트 수. */
+    int64 FileSize = 0;
+
+    /** 저장 성공 여부. 내용이 같아 기록을 건너뛴 경우에도 true. */
+    bool bSuccess = false;
+
+    /** 내용이 마지막 저장 때와 같아 기록을 건너뛰었는지 여부. */
+    bool bSkipped = false;
+};
+
+/**
+ * EditorPackageUtils::CreateAssetPackages 에 전달하는 생성 항목.
+ */
+struct FEditorPackageCreateItem
+{
+    /** 파일 시스템 상의 저장할 디렉터리 경로 (예: "C:/Unreal Projects/YourProject/Content/..."). */
+    FString SaveDirectory;
+
+    /** 저장할 파일 이름 (확장자는 필요하지 않음). 에셋 오브젝트 이름으로도 사용합니다. */
+    FString FileName;
+};
+
+/**
+ * 생성 항목 하나에 대한 결과. EditorPackageUtils::NewAssetInPackage에 넘겨 최종 패키지와 이름으로 에셋을 만듭니다.
+ */
+struct FEditorPackageCreateResult
+{
+    /** 찾거나 새로 만든 패키지. 실패하면 nullptr. */
+    UPackage* Package = nullptr;
+
+    /** 패키지 안에서 사용할 에셋 오브젝트 이름. */
+    FName AssetName;
+
+    /** 패키지를 저장할 파일 경로 (.uasset 포함). */
+    FString Filename;
+};
+
+/**
+ * EditorPackageUtils::ScanDirectoryForPackages 로 찾은 패키지 파일 하나.
+ * 문자열은 FEditorPackageScanResult::StringData 안의 위치로만 보관하므로 항목마다 힙 할당이 없습니다.
+ */
+struct FEditorPackageScanEntry
+{
+    int32 FilenameOffset = 0;
+    int32 FilenameLen = 0;
+    int32 PackageNameOffset = 0;
+    int32 PackageNameLen = 0;
+
+    /** .umap 파일이면 true. */
+    bool bIsMap = false;
+
+    /** Asset Registry에 패키지가 등록되어 있으면 true. 레지스트리를 조회하지 않았으면 항상 false. */
+    bool bRegistered = false;
+};
+
+/**
+ * EditorPackageUtils::ScanDirectoryForPackages 결과.
+ * 모든 파일 경로와 패키지 이름은 StringData 한 버퍼에 연속으로 저장됩니다.
+ */
+struct FEditorPackageScanResult
+{
+    TArray<FEditorPackageScanEntry> Entries;
+    TArray<TCHAR> StringData;
+
+    /** 패키지 확장자이지만 어떤 콘텐츠 루트에도 속하지 않아 제외한 파일 수. */
+    int32 NumUnconvertible = 0;
+
+    /** Asset Registry 등록 여부를 조회했는지 여부. */
+    bool bRegistryQueried = false;
+
+    /** 조회 시점에 Asset Registry가 초기 스캔을 마쳤는지 여부. false이면 bRegistered가 누락되었을 수 있습니다. */
+    bool bRegistryComplete = false;
+
+    int32 Num() const { return Entries.Num(); }
+
+    /** 파일 시스템 경로 (확장자 포함). */
+    FStringView GetFilename(int32 Index) const
+    {
+        const FEditorPackageScanEntry& Entry = Entries[Index];
+        return FStringView(StringData.GetData() + Entry.FilenameOffset, Entry.FilenameLen);
+    }
+
+    /** 패키지 이름. 예: "/Game/MyFolder/MyAsset" */
+    FStringView GetPackageName(int32 Index) const
+    {
+        const FEditorPackageScanEntry& Entry = Entries[Index];
+        return FStringView(StringData.GetData() + Entry.PackageNameOffset, Entry.PackageNameLen);
+    }
+
+    void Reset()
+    {
+        Entries.Reset();
+        StringData.Reset();
+        NumUnconvertible = 0;
+        bRegistryQueried = false;
+        bRegistryComplete = false;
+    }
+};
+
+/**
+ * FEditorPackageSaveSession 하나가 수행한 파일 I/O 통계.
+ */
+struct FEditorPackageSaveSessionStats
+{
+    /** 저장한 패키지 수. */
+    int32 PackagesSaved = 0;
+
+    /** 기록에 실패한 패키지 수. */
+    int32 PackagesFailed = 0;
+
+    /** 디렉터리 캐시로 DirectoryExists 호출을 생략한 횟수. */
+    int32 DirectoryCacheHits = 0;
+
+    /** 캐시에 없어 DirectoryExists를 호출한 횟수. */
+    int32 DirectoryChecks = 0;
+
+    /** 새로 만든 디렉터리 수. */
+    int32 DirectoriesCreated = 0;
+
+    /** 대상 경로에 연 파일 수. */
+    int32 FileWrites = 0;
+
+    /** 임시 파일을 최종 경로로 교체한 횟수. */
+    int32 Renames = 0;
+
+    /** 메모리에 모은 뒤 디스크에 기록하기 전까지 보관한 바이트 수의 최댓값. */
+    int64 PeakStagedBytes = 0;
+
+    /** 대상 경로에 기록한 바이트 수. */
+    int64 BytesWritten = 0;
+
+    /** 패키지 직렬화에 걸린 시간 (초). */
+    double SerializeSeconds = 0.0;
+
+    /** 대상 경로 기록과 교체에 걸린 시간 (초). */
+    double WriteSeconds = 0.0;
+};
+
+/**
+ * FEditorPackageStreamingSaver 의 저장 및 GC 통계.
+ */
+struct FEditorPackageStreamingSaveStats
+{
+    /** 저장한 패키지 수. */
+    int32 PackagesSaved = 0;
+
+    /** 저장에 실패한 패키지 수. */
+    int32 PackagesFailed = 0;
+
+    /** 기록한 바이트 수. */
+    int64 BytesSaved = 0;
+
+    /** 실행한 GC 횟수. */
+    int32 GCCount = 0;
+
+    /** GC와 미뤄 둔 정리(purge)에 쓴 시간 (초). */
+    double GCSeconds = 0.0;
+
+    /** GC 한 번에 걸린 가장 긴 시간 (초). */
+    double MaxGCSeconds = 0.0;
+
+    /** 저장 중 관찰한 가장 큰 물리 메모리 사용량 (RSS). */
+    int64 PeakUsedPhysical = 0;
+
+    /** 마지막 GC 직후의 물리 메모리 사용량. 예산에 가까우면 저장 외의 원인이 메모리를 잡고 있는 것입니다. */
+    int64 UsedPhysicalAfterLastGC = 0;
+
+    /** 현재 GC 간격 (패키지 수). 메모리 증가 속도에 맞춰 조정됩니다. */
+    int32 CurrentGCInterval = 0;
+};